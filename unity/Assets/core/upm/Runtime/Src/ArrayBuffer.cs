@@ -16,6 +16,8 @@ namespace Puerts
     {
         public byte[] Bytes;
         public int Count;
+        // pass Bytes to js without copying, js and c# then see the same memory
+        public bool Shared;
 
         public ArrayBuffer(byte[] bytes)
         {
@@ -42,6 +44,11 @@ namespace Puerts
             }
         }
 
+        public ArrayBuffer(byte[] bytes, int count, bool shared) : this(bytes, count)
+        {
+            Shared = shared;
+        }
+
 #if ENABLE_IL2CPP
         [UnityEngine.Scripting.Preserve]
 #endif
@@ -436,6 +436,43 @@ namespace Puerts
             }
         }
 
+#if UNITY_WEBGL && !UNITY_EDITOR
+        // no InvokeJSFunctionWithArguments on webgl, arguments are still pushed one by one
+        static readonly ISetValueToJs argumentSetter = NativeValueApi.SetValueToArgument;
+
+        static int BeginArguments()
+        {
+            return 0;
+        }
+
+        IntPtr InvokeJSFunction(int argumentFrame, bool hasResult)
+        {
+            return PuertsDLL.InvokeJSFunction(nativeJsFuncPtr, hasResult);
+        }
+
+        static void EndArguments(int argumentFrame)
+        {
+        }
+#else
+        static readonly SetValueToArgumentBlockImpl argumentSetter = NativeValueApi.SetValueToArgumentBlock;
+
+        static int BeginArguments()
+        {
+            return argumentSetter.Begin();
+        }
+
+        IntPtr InvokeJSFunction(int argumentFrame, bool hasResult)
+        {
+            return argumentSetter.Invoke(nativeJsFuncPtr, argumentFrame, hasResult);
+        }
+
+        // frees what a throwing setter left pinned, and hands the frame back for the next call
+        static void EndArguments(int argumentFrame)
+        {
+            argumentSetter.End(argumentFrame);
+        }
+#endif
+
         public void Action()
         {
             CheckLiveness();
@@ -459,8 +496,17 @@ namespace Puerts
 #if THREAD_SAFE
             lock(jsEnv) {
 #endif
-            StaticTranslate<T1>.Set(jsEnv.Idx, isolate, NativeValueApi.SetValueToArgument, nativeJsFuncPtr, p1);
-            IntPtr resultInfo = PuertsDLL.InvokeJSFunction(nativeJsFuncPtr, false);
+            int argumentFrame = BeginArguments();
+            IntPtr resultInfo;
+            try
+            {
+                StaticTranslate<T1>.Set(jsEnv.Idx, isolate, argumentSetter, nativeJsFuncPtr, p1);
+                resultInfo = InvokeJSFunction(argumentFrame, false);
+            }
+            finally
+            {
+                EndArguments(argumentFrame);
+            }
             if (resultInfo == IntPtr.Zero)
             {
                 string exceptionInfo = PuertsDLL.GetFunctionLastExceptionInfo(nativeJsFuncPtr);
@@ -477,9 +523,18 @@ namespace Puerts
 #if THREAD_SAFE
             lock(jsEnv) {
 #endif
-            StaticTranslate<T1>.Set(jsEnv.Idx, isolate, NativeValueApi.SetValueToArgument, nativeJsFuncPtr, p1);
-            StaticTranslate<T2>.Set(jsEnv.Idx, isolate, NativeValueApi.SetValueToArgument, nativeJsFuncPtr, p2);
-            IntPtr resultInfo = PuertsDLL.InvokeJSFunction(nativeJsFuncPtr, false);
+            int argumentFrame = BeginArguments();
+            IntPtr resultInfo;
+            try
+            {
+                StaticTranslate<T1>.Set(jsEnv.Idx, isolate, argumentSetter, nativeJsFuncPtr, p1);
+                StaticTranslate<T2>.Set(jsEnv.Idx, isolate, argumentSetter, nativeJsFuncPtr, p2);
+                resultInfo = InvokeJSFunction(argumentFrame, false);
+            }
+            finally
+            {
+                EndArguments(argumentFrame);
+            }
             if (resultInfo == IntPtr.Zero)
             {
                 string exceptionInfo = PuertsDLL.GetFunctionLastExceptionInfo(nativeJsFuncPtr);
@@ -496,10 +551,19 @@ namespace Puerts
 #if THREAD_SAFE
             lock(jsEnv) {
 #endif
-            StaticTranslate<T1>.Set(jsEnv.Idx, isolate, NativeValueApi.SetValueToArgument, nativeJsFuncPtr, p1);
-            StaticTranslate<T2>.Set(jsEnv.Idx, isolate, NativeValueApi.SetValueToArgument, nativeJsFuncPtr, p2);
-            StaticTranslate<T3>.Set(jsEnv.Idx, isolate, NativeValueApi.SetValueToArgument, nativeJsFuncPtr, p3);
-            IntPtr resultInfo = PuertsDLL.InvokeJSFunction(nativeJsFuncPtr, false);
+            int argumentFrame = BeginArguments();
+            IntPtr resultInfo;
+            try
+            {
+                StaticTranslate<T1>.Set(jsEnv.Idx, isolate, argumentSetter, nativeJsFuncPtr, p1);
+                StaticTranslate<T2>.Set(jsEnv.Idx, isolate, argumentSetter, nativeJsFuncPtr, p2);
+                StaticTranslate<T3>.Set(jsEnv.Idx, isolate, argumentSetter, nativeJsFuncPtr, p3);
+                resultInfo = InvokeJSFunction(argumentFrame, false);
+            }
+            finally
+            {
+                EndArguments(argumentFrame);
+            }
             if (resultInfo == IntPtr.Zero)
             {
                 string exceptionInfo = PuertsDLL.GetFunctionLastExceptionInfo(nativeJsFuncPtr);
@@ -516,11 +580,20 @@ namespace Puerts
 #if THREAD_SAFE
             lock(jsEnv) {
 #endif
-            StaticTranslate<T1>.Set(jsEnv.Idx, isolate, NativeValueApi.SetValueToArgument, nativeJsFuncPtr, p1);
-            StaticTranslate<T2>.Set(jsEnv.Idx, isolate, NativeValueApi.SetValueToArgument, nativeJsFuncPtr, p2);
-            StaticTranslate<T3>.Set(jsEnv.Idx, isolate, NativeValueApi.SetValueToArgument, nativeJsFuncPtr, p3);
-            StaticTranslate<T4>.Set(jsEnv.Idx, isolate, NativeValueApi.SetValueToArgument, nativeJsFuncPtr, p4);
-            IntPtr resultInfo = PuertsDLL.InvokeJSFunction(nativeJsFuncPtr, false);
+            int argumentFrame = BeginArguments();
+            IntPtr resultInfo;
+            try
+            {
+                StaticTranslate<T1>.Set(jsEnv.Idx, isolate, argumentSetter, nativeJsFuncPtr, p1);
+                StaticTranslate<T2>.Set(jsEnv.Idx, isolate, argumentSetter, nativeJsFuncPtr, p2);
+                StaticTranslate<T3>.Set(jsEnv.Idx, isolate, argumentSetter, nativeJsFuncPtr, p3);
+                StaticTranslate<T4>.Set(jsEnv.Idx, isolate, argumentSetter, nativeJsFuncPtr, p4);
+                resultInfo = InvokeJSFunction(argumentFrame, false);
+            }
+            finally
+            {
+                EndArguments(argumentFrame);
+            }
             if (resultInfo == IntPtr.Zero)
             {
                 string exceptionInfo = PuertsDLL.GetFunctionLastExceptionInfo(nativeJsFuncPtr);
@@ -557,8 +630,17 @@ namespace Puerts
 #if THREAD_SAFE
             lock(jsEnv) {
 #endif
-            StaticTranslate<T1>.Set(jsEnv.Idx, isolate, NativeValueApi.SetValueToArgument, nativeJsFuncPtr, p1);
-            IntPtr resultInfo = PuertsDLL.InvokeJSFunction(nativeJsFuncPtr, true);
+            int argumentFrame = BeginArguments();
+            IntPtr resultInfo;
+            try
+            {
+                StaticTranslate<T1>.Set(jsEnv.Idx, isolate, argumentSetter, nativeJsFuncPtr, p1);
+                resultInfo = InvokeJSFunction(argumentFrame, true);
+            }
+            finally
+            {
+                EndArguments(argumentFrame);
+            }
             if (resultInfo == IntPtr.Zero)
             {
                 string exceptionInfo = PuertsDLL.GetFunctionLastExceptionInfo(nativeJsFuncPtr);
@@ -578,9 +660,18 @@ namespace Puerts
 #if THREAD_SAFE
             lock(jsEnv) {
 #endif
-            StaticTranslate<T1>.Set(jsEnv.Idx, isolate, NativeValueApi.SetValueToArgument, nativeJsFuncPtr, p1);
-            StaticTranslate<T2>.Set(jsEnv.Idx, isolate, NativeValueApi.SetValueToArgument, nativeJsFuncPtr, p2);
-            IntPtr resultInfo = PuertsDLL.InvokeJSFunction(nativeJsFuncPtr, true);
+            int argumentFrame = BeginArguments();
+            IntPtr resultInfo;
+            try
+            {
+                StaticTranslate<T1>.Set(jsEnv.Idx, isolate, argumentSetter, nativeJsFuncPtr, p1);
+                StaticTranslate<T2>.Set(jsEnv.Idx, isolate, argumentSetter, nativeJsFuncPtr, p2);
+                resultInfo = InvokeJSFunction(argumentFrame, true);
+            }
+            finally
+            {
+                EndArguments(argumentFrame);
+            }
             if (resultInfo == IntPtr.Zero)
             {
                 string exceptionInfo = PuertsDLL.GetFunctionLastExceptionInfo(nativeJsFuncPtr);
@@ -600,10 +691,19 @@ namespace Puerts
 #if THREAD_SAFE
             lock(jsEnv) {
 #endif
-            StaticTranslate<T1>.Set(jsEnv.Idx, isolate, NativeValueApi.SetValueToArgument, nativeJsFuncPtr, p1);
-            StaticTranslate<T2>.Set(jsEnv.Idx, isolate, NativeValueApi.SetValueToArgument, nativeJsFuncPtr, p2);
-            StaticTranslate<T3>.Set(jsEnv.Idx, isolate, NativeValueApi.SetValueToArgument, nativeJsFuncPtr, p3);
-            IntPtr resultInfo = PuertsDLL.InvokeJSFunction(nativeJsFuncPtr, true);
+            int argumentFrame = BeginArguments();
+            IntPtr resultInfo;
+            try
+            {
+                StaticTranslate<T1>.Set(jsEnv.Idx, isolate, argumentSetter, nativeJsFuncPtr, p1);
+                StaticTranslate<T2>.Set(jsEnv.Idx, isolate, argumentSetter, nativeJsFuncPtr, p2);
+                StaticTranslate<T3>.Set(jsEnv.Idx, isolate, argumentSetter, nativeJsFuncPtr, p3);
+                resultInfo = InvokeJSFunction(argumentFrame, true);
+            }
+            finally
+            {
+                EndArguments(argumentFrame);
+            }
             if (resultInfo == IntPtr.Zero)
             {
                 string exceptionInfo = PuertsDLL.GetFunctionLastExceptionInfo(nativeJsFuncPtr);
@@ -623,11 +723,20 @@ namespace Puerts
 #if THREAD_SAFE
             lock(jsEnv) {
 #endif
-            StaticTranslate<T1>.Set(jsEnv.Idx, isolate, NativeValueApi.SetValueToArgument, nativeJsFuncPtr, p1);
-            StaticTranslate<T2>.Set(jsEnv.Idx, isolate, NativeValueApi.SetValueToArgument, nativeJsFuncPtr, p2);
-            StaticTranslate<T3>.Set(jsEnv.Idx, isolate, NativeValueApi.SetValueToArgument, nativeJsFuncPtr, p3);
-            StaticTranslate<T4>.Set(jsEnv.Idx, isolate, NativeValueApi.SetValueToArgument, nativeJsFuncPtr, p4);
-            IntPtr resultInfo = PuertsDLL.InvokeJSFunction(nativeJsFuncPtr, true);
+            int argumentFrame = BeginArguments();
+            IntPtr resultInfo;
+            try
+            {
+                StaticTranslate<T1>.Set(jsEnv.Idx, isolate, argumentSetter, nativeJsFuncPtr, p1);
+                StaticTranslate<T2>.Set(jsEnv.Idx, isolate, argumentSetter, nativeJsFuncPtr, p2);
+                StaticTranslate<T3>.Set(jsEnv.Idx, isolate, argumentSetter, nativeJsFuncPtr, p3);
+                StaticTranslate<T4>.Set(jsEnv.Idx, isolate, argumentSetter, nativeJsFuncPtr, p4);
+                resultInfo = InvokeJSFunction(argumentFrame, true);
+            }
+            finally
+            {
+                EndArguments(argumentFrame);
+            }
             if (resultInfo == IntPtr.Zero)
             {
                 string exceptionInfo = PuertsDLL.GetFunctionLastExceptionInfo(nativeJsFuncPtr);
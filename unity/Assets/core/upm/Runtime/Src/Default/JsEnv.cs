@@ -400,6 +400,52 @@ namespace Puerts
 #endif
         }
 
+        /// <summary>
+        /// Enable the on-disk code cache for ES modules, a null or empty dir disables it.
+        /// The directory must exist and be writable. Not available on webgl, where this does nothing.
+        /// </summary>
+        public void SetModuleCodeCacheDir(string dir)
+        {
+#if !(UNITY_WEBGL && !UNITY_EDITOR)
+#if THREAD_SAFE
+            lock(this) {
+#endif
+            PuertsDLL.SetModuleCodeCacheDir(isolate, dir);
+#if THREAD_SAFE
+            }
+#endif
+#endif
+        }
+
+        /// <summary>
+        /// Use the ES module code caches precompiled by `v8cc --batch=&lt;dir&gt; --bundle=&lt;path&gt;`, a null path unloads them.
+        /// Entries are looked up by module path, so build the bundle from the directory the loader resolves modules against,
+        /// with the same v8 flags. Returns false if the bundle is missing or does not match this v8, always false on webgl.
+        /// </summary>
+        public bool SetModuleCodeCacheBundle(string path)
+        {
+#if UNITY_WEBGL && !UNITY_EDITOR
+            return false;
+#else
+#if THREAD_SAFE
+            lock(this) {
+#endif
+            return PuertsDLL.SetModuleCodeCacheBundle(isolate, path);
+#if THREAD_SAFE
+            }
+#endif
+#endif
+        }
+
+        public void GetModuleCodeCacheStats(out int hits, out int misses, out int rejected)
+        {
+#if UNITY_WEBGL && !UNITY_EDITOR
+            hits = misses = rejected = 0;
+#else
+            PuertsDLL.GetModuleCodeCacheStats(isolate, out hits, out misses, out rejected);
+#endif
+        }
+
         public static void ClearAllModuleCaches () 
         {
             lock (jsEnvs)
@@ -47,6 +47,11 @@ namespace Puerts
 #endif
     public delegate void LogCallback(string content);
 
+#if UNITY_EDITOR_WIN || UNITY_STANDALONE_WIN || PUERTS_GENERAL || (UNITY_WSA && !UNITY_EDITOR)
+    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+#endif
+    public delegate void ArrayBufferReleaseCallback(IntPtr data, IntPtr userData);
+
     [Flags]
     public enum JsValueType
     {
@@ -66,6 +71,25 @@ namespace Puerts
         Any = NullOrUndefined | BigInt | Number | String | Boolean | NativeObject | JsObject | Array | Function | Date | ArrayBuffer,
     };
 
+    /// <summary>
+    /// one entry of the argument block passed to InvokeJSFunctionWithArguments, mirrors puerts::FArgumentValue.
+    /// Length is the byte length for String/ArrayBuffer and the class id for NativeObject.
+    /// Ptr of a String or copied ArrayBuffer is the byte offset of its data in the buffer passed along with the block.
+    /// Release/ReleaseUserData are only set for a shared ArrayBuffer.
+    /// </summary>
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    public struct JSArgumentValue
+    {
+        [FieldOffset(0)] public JsValueType Type;
+        [FieldOffset(4)] public int Length;
+        [FieldOffset(8)] public double Number;
+        [FieldOffset(8)] public long BigInt;
+        [FieldOffset(8)] public int Boolean;
+        [FieldOffset(8)] public IntPtr Ptr;
+        [FieldOffset(16)] public long Release;
+        [FieldOffset(24)] public long ReleaseUserData;
+    }
+
     public class PuertsDLL
     {
 #if (UNITY_IPHONE || UNITY_TVOS || UNITY_WEBGL || UNITY_SWITCH) && !UNITY_EDITOR
@@ -198,6 +222,15 @@ namespace Puerts
         [DllImport(DLLNAME, CallingConvention = CallingConvention.Cdecl)]
         public static extern bool ClearModuleCache(IntPtr isolate, string path);
 
+        [DllImport(DLLNAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void SetModuleCodeCacheDir(IntPtr isolate, string dir);
+
+        [DllImport(DLLNAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern bool SetModuleCodeCacheBundle(IntPtr isolate, string path);
+
+        [DllImport(DLLNAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void GetModuleCodeCacheStats(IntPtr isolate, out int hits, out int misses, out int rejected);
+
 #if PUERTS_GENERAL && !PUERTS_GENERAL_OSX
         [DllImport(DLLNAME, CallingConvention = CallingConvention.Cdecl)]
         public static extern IntPtr Eval(IntPtr isolate, byte[] code, string path);
@@ -544,6 +577,9 @@ namespace Puerts
         [DllImport(DLLNAME, CallingConvention = CallingConvention.Cdecl)]
         public static extern IntPtr InvokeJSFunction(IntPtr function, bool hasResult);
 
+        [DllImport(DLLNAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern IntPtr InvokeJSFunctionWithArguments(IntPtr function, [In] JSArgumentValue[] arguments, int argumentCount, [In] byte[] buffer, bool hasResult);
+
         [DllImport(DLLNAME, CallingConvention = CallingConvention.Cdecl)]
         public static extern IntPtr GetFunctionLastExceptionInfo(IntPtr function, out int len);
 
@@ -654,6 +690,73 @@ namespace Puerts
         [DllImport(DLLNAME, CallingConvention = CallingConvention.Cdecl)]
         public static extern IntPtr GetArrayBufferFromResult(IntPtr function, out int length);
 
+#if !(UNITY_WEBGL && !UNITY_EDITOR)
+        // zero copy exchange: once js drops the ArrayBuffer the release is queued natively,
+        // and the callback runs from LogicTick or LowMemoryNotification on the thread calling them
+        [DllImport(DLLNAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void ReturnExternalArrayBuffer(IntPtr isolate, IntPtr info, IntPtr data, int length, IntPtr release, IntPtr userData);
+        [DllImport(DLLNAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void SetExternalArrayBufferToOutValue(IntPtr isolate, IntPtr value, IntPtr data, int length, IntPtr release, IntPtr userData);
+        [DllImport(DLLNAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void PushExternalArrayBufferForJSFunction(IntPtr function, IntPtr data, int length, IntPtr release, IntPtr userData);
+#endif
+
+        static readonly ArrayBufferReleaseCallback pinnedArrayBufferRelease = PinnedArrayBufferRelease;
+        internal static readonly IntPtr pinnedArrayBufferReleasePtr = Marshal.GetFunctionPointerForDelegate(pinnedArrayBufferRelease);
+
+        [MonoPInvokeCallback(typeof(ArrayBufferReleaseCallback))]
+        static void PinnedArrayBufferRelease(IntPtr data, IntPtr userData)
+        {
+            GCHandle.FromIntPtr(userData).Free();
+        }
+
+        // the byte[] stays pinned and shared with js until the ArrayBuffer is collected
+        internal static IntPtr PinArrayBuffer(byte[] bytes, out IntPtr handle)
+        {
+            var gcHandle = GCHandle.Alloc(bytes, GCHandleType.Pinned);
+            handle = GCHandle.ToIntPtr(gcHandle);
+            return gcHandle.AddrOfPinnedObject();
+        }
+
+#if UNITY_WEBGL && !UNITY_EDITOR
+        // js can not see the wasm heap as external memory on webgl, shared buffers are copied like the others
+        public static void ReturnSharedArrayBuffer(IntPtr isolate, IntPtr info, byte[] bytes, int length)
+        {
+            ReturnArrayBuffer(isolate, info, bytes, length);
+        }
+
+        public static void SetSharedArrayBufferToOutValue(IntPtr isolate, IntPtr value, byte[] bytes, int length)
+        {
+            SetArrayBufferToOutValue(isolate, value, bytes, length);
+        }
+
+        public static void PushSharedArrayBufferForJSFunction(IntPtr function, byte[] bytes, int length)
+        {
+            PushArrayBufferForJSFunction(function, bytes, length);
+        }
+#else
+        public static void ReturnSharedArrayBuffer(IntPtr isolate, IntPtr info, byte[] bytes, int length)
+        {
+            IntPtr handle;
+            var data = PinArrayBuffer(bytes, out handle);
+            ReturnExternalArrayBuffer(isolate, info, data, length, pinnedArrayBufferReleasePtr, handle);
+        }
+
+        public static void SetSharedArrayBufferToOutValue(IntPtr isolate, IntPtr value, byte[] bytes, int length)
+        {
+            IntPtr handle;
+            var data = PinArrayBuffer(bytes, out handle);
+            SetExternalArrayBufferToOutValue(isolate, value, data, length, pinnedArrayBufferReleasePtr, handle);
+        }
+
+        public static void PushSharedArrayBufferForJSFunction(IntPtr function, byte[] bytes, int length)
+        {
+            IntPtr handle;
+            var data = PinArrayBuffer(bytes, out handle);
+            PushExternalArrayBufferForJSFunction(function, data, length, pinnedArrayBufferReleasePtr, handle);
+        }
+#endif
+
         [DllImport(DLLNAME, CallingConvention = CallingConvention.Cdecl)]
         public static extern IntPtr GetJSStackTrace(IntPtr isolate, out int len);
         public static string GetJSStackTrace(IntPtr isolate)
@@ -8,6 +8,8 @@
 #if !PUERTS_IL2CPP_OPTIMIZATION || !ENABLE_IL2CPP
 
 using System;
+using System.Runtime.InteropServices;
+using System.Text;
 
 namespace Puerts
 {
@@ -22,6 +24,8 @@ namespace Puerts
         public static ISetValueToJs SetValueToByRefArgument = new SetValueToByRefArgumentImpl();
 
         public static ISetValueToJs SetValueToArgument = new SetValueToArgumentImpl();
+
+        public static SetValueToArgumentBlockImpl SetValueToArgumentBlock = new SetValueToArgumentBlockImpl();
     }
 
     public interface ISetValueToJs
@@ -200,6 +204,10 @@ namespace Puerts
             {
                 PuertsDLL.ReturnArrayBuffer(isolate, holder, null, 0);
             }
+            else if (arrayBuffer.Shared)
+            {
+                PuertsDLL.ReturnSharedArrayBuffer(isolate, holder, arrayBuffer.Bytes, arrayBuffer.Count);
+            }
             else
             {
                 PuertsDLL.ReturnArrayBuffer(isolate, holder, arrayBuffer.Bytes, arrayBuffer.Count);
@@ -260,6 +268,10 @@ namespace Puerts
             {
                 PuertsDLL.SetArrayBufferToOutValue(isolate, holder, null, 0);
             }
+            else if (arrayBuffer.Shared)
+            {
+                PuertsDLL.SetSharedArrayBufferToOutValue(isolate, holder, arrayBuffer.Bytes, arrayBuffer.Count);
+            }
             else
             {
                 PuertsDLL.SetArrayBufferToOutValue(isolate, holder, arrayBuffer.Bytes, arrayBuffer.Count);
@@ -320,6 +332,10 @@ namespace Puerts
             {
                 PuertsDLL.PushArrayBufferForJSFunction(holder, null, 0);
             }
+            else if (arrayBuffer.Shared)
+            {
+                PuertsDLL.PushSharedArrayBufferForJSFunction(holder, arrayBuffer.Bytes, arrayBuffer.Count);
+            }
             else
             {
                 PuertsDLL.PushArrayBufferForJSFunction(holder, arrayBuffer.Bytes, arrayBuffer.Count);
@@ -371,6 +387,198 @@ namespace Puerts
             PuertsDLL.PushStringForJSFunction(holder, str);
         }
     }
+
+    // collects the arguments of one call into a block that InvokeJSFunctionWithArguments takes in a single P/Invoke,
+    // holder is ignored. A call runs Begin, the setters, Invoke and then End in a finally. Each call gets the frame of
+    // its depth, so calls nested in a setter or in the js function do not touch the outer arguments. Frames are kept
+    // for the next call at the same depth, and strings and copied ArrayBuffers go to the frame's byte buffer, so the
+    // argument path does not allocate once the buffers are large enough.
+    public class SetValueToArgumentBlockImpl : ISetValueToJs
+    {
+        class Frame
+        {
+            public JSArgumentValue[] Arguments = new JSArgumentValue[8];
+            public int Count;
+            // passed to native as a whole, String and copied ArrayBuffer entries keep their offset in Ptr
+            public byte[] Bytes = new byte[256];
+            public int BytesUsed;
+            // set while a shared ArrayBuffer pinned by PinArrayBuffer has not been handed to native yet
+            public bool HasPinned;
+        }
+
+        [ThreadStatic] static Frame[] frames;
+        [ThreadStatic] static int depth;
+
+        public int Begin()
+        {
+            if (frames == null)
+            {
+                frames = new Frame[4];
+            }
+            else if (depth == frames.Length)
+            {
+                Array.Resize(ref frames, depth * 2);
+            }
+            Frame frame = frames[depth];
+            if (frame == null)
+            {
+                frame = frames[depth] = new Frame();
+            }
+            frame.Count = 0;
+            frame.BytesUsed = 0;
+            frame.HasPinned = false;
+            return depth++;
+        }
+
+        public IntPtr Invoke(IntPtr function, int frameIndex, bool hasResult)
+        {
+            Frame frame = frames[frameIndex];
+            IntPtr resultInfo = PuertsDLL.InvokeJSFunctionWithArguments(function, frame.Arguments, frame.Count, frame.Bytes, hasResult);
+            // every argument is converted before the js function runs, the shared buffers belong to js now
+            frame.HasPinned = false;
+            return resultInfo;
+        }
+
+        public void End(int frameIndex)
+        {
+            Frame frame = frames[frameIndex];
+            if (frame.HasPinned)
+            {
+                // a setter threw before Invoke, native never took these
+                for (int i = 0; i < frame.Count; i++)
+                {
+                    if (frame.Arguments[i].Type == JsValueType.ArrayBuffer && frame.Arguments[i].Release != 0)
+                    {
+                        GCHandle.FromIntPtr(new IntPtr(frame.Arguments[i].ReleaseUserData)).Free();
+                    }
+                }
+                frame.HasPinned = false;
+            }
+            frame.Count = 0;
+            depth = frameIndex;
+        }
+
+        static Frame Next(JsValueType type, out int index)
+        {
+            Frame frame = frames[depth - 1];
+            if (frame.Count == frame.Arguments.Length)
+            {
+                Array.Resize(ref frame.Arguments, frame.Count * 2);
+            }
+            index = frame.Count++;
+            frame.Arguments[index] = default(JSArgumentValue);
+            frame.Arguments[index].Type = type;
+            return frame;
+        }
+
+        // returns the offset of length free bytes in frame.Bytes
+        static int Reserve(Frame frame, int length)
+        {
+            int offset = frame.BytesUsed;
+            if (offset + length > frame.Bytes.Length)
+            {
+                int size = frame.Bytes.Length * 2;
+                while (size < offset + length)
+                {
+                    size *= 2;
+                }
+                Array.Resize(ref frame.Bytes, size);
+            }
+            frame.BytesUsed = offset + length;
+            return offset;
+        }
+
+        public void SetArrayBuffer(IntPtr isolate, IntPtr holder, ArrayBuffer arrayBuffer)
+        {
+            int index;
+            Frame frame = Next(JsValueType.ArrayBuffer, out index);
+            if (arrayBuffer == null || arrayBuffer.Bytes == null)
+            {
+                return;
+            }
+            frame.Arguments[index].Length = arrayBuffer.Count;
+            if (arrayBuffer.Shared)
+            {
+                IntPtr handle;
+                frame.Arguments[index].Ptr = PuertsDLL.PinArrayBuffer(arrayBuffer.Bytes, out handle);
+                frame.Arguments[index].Release = PuertsDLL.pinnedArrayBufferReleasePtr.ToInt64();
+                frame.Arguments[index].ReleaseUserData = handle.ToInt64();
+                frame.HasPinned = true;
+            }
+            else
+            {
+                int offset = Reserve(frame, arrayBuffer.Count);
+                Buffer.BlockCopy(arrayBuffer.Bytes, 0, frame.Bytes, offset, arrayBuffer.Count);
+                frame.Arguments[index].Ptr = new IntPtr(offset);
+            }
+        }
+
+        public void SetBigInt(IntPtr isolate, IntPtr holder, long number)
+        {
+            int index;
+            Next(JsValueType.BigInt, out index).Arguments[index].BigInt = number;
+        }
+
+        public void SetBoolean(IntPtr isolate, IntPtr holder, bool b)
+        {
+            int index;
+            Next(JsValueType.Boolean, out index).Arguments[index].Boolean = b ? 1 : 0;
+        }
+
+        public void SetDate(IntPtr isolate, IntPtr holder, double date)
+        {
+            int index;
+            Next(JsValueType.Date, out index).Arguments[index].Number = date;
+        }
+
+        public void SetNull(IntPtr isolate, IntPtr holder)
+        {
+            int index;
+            Next(JsValueType.NullOrUndefined, out index);
+        }
+
+        public void SetNumber(IntPtr isolate, IntPtr holder, double number)
+        {
+            int index;
+            Next(JsValueType.Number, out index).Arguments[index].Number = number;
+        }
+
+        public void SetNativeObject(IntPtr isolate, IntPtr holder, int classID, IntPtr self)
+        {
+            int index;
+            Frame frame = Next(JsValueType.NativeObject, out index);
+            frame.Arguments[index].Length = classID;
+            frame.Arguments[index].Ptr = self;
+        }
+
+        public void SetFunction(IntPtr isolate, IntPtr holder, IntPtr JSFunction)
+        {
+            int index;
+            Next(JsValueType.Function, out index).Arguments[index].Ptr = JSFunction;
+        }
+
+        public void SetJSObject(IntPtr isolate, IntPtr holder, IntPtr JSObject)
+        {
+            int index;
+            Next(JsValueType.JsObject, out index).Arguments[index].Ptr = JSObject;
+        }
+
+        public void SetString(IntPtr isolate, IntPtr holder, string str)
+        {
+            int index;
+            if (str == null)
+            {
+                Next(JsValueType.NullOrUndefined, out index);
+                return;
+            }
+            Frame frame = Next(JsValueType.String, out index);
+            int offset = Reserve(frame, Encoding.UTF8.GetMaxByteCount(str.Length));
+            int length = Encoding.UTF8.GetBytes(str, 0, str.Length, frame.Bytes, offset);
+            frame.BytesUsed = offset + length;
+            frame.Arguments[index].Length = length;
+            frame.Arguments[index].Ptr = new IntPtr(offset);
+        }
+    }
 }
 
 #endif
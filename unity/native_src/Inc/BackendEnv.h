@@ -10,6 +10,8 @@
 #include <map>
 #include <algorithm>
 #include <unordered_map>
+#include <vector>
+#include <string>
 #include "Common.h"
 #include "Log.h"
 #include "V8InspectorImpl.h"
@@ -117,7 +119,23 @@ namespace PUERTS_NAMESPACE
         v8::MaybeLocal<v8::Module> FetchModuleTree(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::String> absolute_file_path);
         
         std::unordered_multimap<int, FBackendEnv::FModuleInfo*>::iterator FindModuleInfo(v8::Local<v8::Module> Module);
-        
+
+        // modules compiled without a usable code cache, written to disk once instantiated
+        struct FPendingCodeCache
+        {
+            std::string CacheFile;
+            uint64_t SourceHash;
+            v8::Global<v8::Module> Module;
+        };
+        std::vector<FPendingCodeCache> PendingCodeCaches;
+
+        v8::ScriptCompiler::CachedData* LoadCodeCache(const std::string& CacheFile, uint64_t SourceHash);
+
+        void SaveCodeCaches(v8::Isolate* Isolate);
+
+        // a module tree that failed to fetch or instantiate must not be written by a later save
+        void DiscardCodeCaches();
+
         static v8::MaybeLocal<v8::Module> ResolveModuleCallback(v8::Local<v8::Context> context, v8::Local<v8::String> specifier,
 #if V8_94_OR_NEWER
             v8::Local<v8::FixedArray> import_attributes,    // not implement yet
@@ -126,6 +144,20 @@ namespace PUERTS_NAMESPACE
 #endif
         std::map<int, std::string> ScriptIdToPathMap;
 
+        // ES module code cache, disabled while CodeCacheDir is empty
+        std::string CodeCacheDir;
+        int32_t CodeCacheHits = 0;
+        int32_t CodeCacheMisses = 0;
+        int32_t CodeCacheRejected = 0;
+
+        void SetCodeCacheDir(const char* Dir);
+
+        // bundle written by `v8cc --batch`, looked up by module path before CodeCacheDir
+        std::vector<uint8_t> CodeCacheBundle;
+
+        // false and no bundle if the file is missing or built by another v8 version or flags, a null Path unloads it
+        bool SetCodeCacheBundle(const char* Path);
+
         // PromiseCallback
         v8::UniquePersistent<v8::Function> JsPromiseRejectCallback;
         
@@ -0,0 +1,118 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+// Layout of the bundle written by `v8cc --batch`, all integers little endian:
+//
+//   CodeCacheBundleHeader
+//   CodeCacheBundleEntry[EntryCount]   sorted by path
+//   path strings                       not null terminated
+//   payloads                           each aligned to kCodeCacheBundleAlignment
+//
+// The file is meant to be loaded as a whole, a payload can be handed to v8::ScriptCompiler::CachedData
+// with BufferNotOwned directly, no copy needed. FBackendEnv::SetCodeCacheBundle consumes it for ES modules.
+// Shared by v8cc and the plugin, so it depends on nothing but the C library.
+
+#include <stdint.h>
+#include <string.h>
+
+static const uint32_t kCodeCacheBundleMagic = 0x42434356;    // "VCCB"
+static const uint32_t kCodeCacheBundleVersion = 2;
+static const uint32_t kCodeCacheBundleAlignment = 16;
+
+enum CodeCacheBundleFlags : uint32_t
+{
+    kCodeCacheBundleModule = 1,
+    kCodeCacheBundleCjsWrapped = 2,
+};
+
+struct CodeCacheBundleHeader
+{
+    uint32_t MagicNumber;
+    uint32_t Version;
+    uint32_t EntryCount;
+    uint32_t VersionTag;    // v8::ScriptCompiler::CachedDataVersionTag() of v8cc, covers v8 version and flags
+};
+
+struct CodeCacheBundleEntry
+{
+    uint64_t SourceHash;    // fnv-1a of the original source text
+    uint64_t PayloadOffset;
+    uint32_t PayloadLength;
+    uint32_t PathOffset;
+    uint32_t PathLength;
+    uint32_t Flags;
+};
+
+inline uint64_t CodeCacheBundleHash(const char* Data, size_t Length)
+{
+    uint64_t Hash = 14695981039346656037ull;
+    for (size_t i = 0; i < Length; ++i)
+    {
+        Hash ^= static_cast<uint8_t>(Data[i]);
+        Hash *= 1099511628211ull;
+    }
+    return Hash;
+}
+
+// VersionTag is v8::ScriptCompiler::CachedDataVersionTag() of the engine that is going to consume the payloads
+inline bool IsValidCodeCacheBundle(const uint8_t* Bundle, size_t BundleSize, uint32_t VersionTag)
+{
+    if (BundleSize < sizeof(CodeCacheBundleHeader))
+    {
+        return false;
+    }
+    const CodeCacheBundleHeader* Header = reinterpret_cast<const CodeCacheBundleHeader*>(Bundle);
+    return Header->MagicNumber == kCodeCacheBundleMagic && Header->Version == kCodeCacheBundleVersion &&
+           Header->VersionTag == VersionTag &&
+           BundleSize >= sizeof(CodeCacheBundleHeader) + sizeof(CodeCacheBundleEntry) * static_cast<size_t>(Header->EntryCount);
+}
+
+// binary search in a loaded bundle, returns nullptr if the bundle is invalid for VersionTag or Path is absent
+inline const CodeCacheBundleEntry* FindCodeCacheBundleEntry(
+    const uint8_t* Bundle, size_t BundleSize, uint32_t VersionTag, const char* Path, size_t PathLength)
+{
+    if (!IsValidCodeCacheBundle(Bundle, BundleSize, VersionTag))
+    {
+        return nullptr;
+    }
+    const CodeCacheBundleHeader* Header = reinterpret_cast<const CodeCacheBundleHeader*>(Bundle);
+    const CodeCacheBundleEntry* Entries = reinterpret_cast<const CodeCacheBundleEntry*>(Header + 1);
+    size_t Low = 0;
+    size_t High = Header->EntryCount;
+    while (Low < High)
+    {
+        size_t Mid = (Low + High) / 2;
+        const CodeCacheBundleEntry& Entry = Entries[Mid];
+        if (static_cast<size_t>(Entry.PathOffset) + Entry.PathLength > BundleSize)
+        {
+            return nullptr;
+        }
+        const char* EntryPath = reinterpret_cast<const char*>(Bundle + Entry.PathOffset);
+        size_t CommonLength = Entry.PathLength < PathLength ? Entry.PathLength : PathLength;
+        int Cmp = memcmp(EntryPath, Path, CommonLength);
+        if (Cmp == 0)
+        {
+            Cmp = Entry.PathLength < PathLength ? -1 : (Entry.PathLength > PathLength ? 1 : 0);
+        }
+        if (Cmp == 0)
+        {
+            return Entry.PayloadOffset + Entry.PayloadLength <= BundleSize ? &Entry : nullptr;
+        }
+        if (Cmp < 0)
+        {
+            Low = Mid + 1;
+        }
+        else
+        {
+            High = Mid;
+        }
+    }
+    return nullptr;
+}
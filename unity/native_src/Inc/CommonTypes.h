@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <stdint.h>
+
 namespace puerts
 {
 
@@ -29,6 +31,26 @@ enum JsValueType
     Unknow          = 2048,
 };
 
+// one entry of a caller owned argument block, same layout on 32 and 64 bit
+struct FArgumentValue
+{
+    int32_t Type;   // JsValueType
+    int32_t Length; // byte length of String and ArrayBuffer, class id of NativeObject
+    union
+    {
+        double Number;
+        int64_t BigInt;
+        int32_t Boolean;
+        // String and copied ArrayBuffer: byte offset into the call's Buffer, so the caller can fill one reusable buffer.
+        // Otherwise shared ArrayBuffer bytes, native object, JSFunction or JSObject
+        const void* Ptr;
+    };
+    // ArrayBuffer only: when set the bytes are shared with js instead of copied,
+    // Release(Ptr, ReleaseUserData) runs once js drops them
+    int64_t Release;
+    int64_t ReleaseUserData;
+};
+
 
 }
 
@@ -19,6 +19,7 @@ PRAGMA_ENABLE_UNDEFINED_IDENTIFIER_WARNINGS
 #include <unordered_map>
 #include "JSClassRegister.h"
 #include "ObjectCacheNode.h"
+#include "PointerHashMap.h"
 #include "ObjectMapper.h"
 
 namespace v8impl
@@ -51,6 +52,8 @@ struct PesapiCallbackData
     class FCppObjectMapper* CppObjectMapper;
     v8::Global<v8::Function> JsFunction;
     pesapi_function_finalize Finalize = nullptr;
+    // position in FCppObjectMapper::FunctionDatas, kept up to date so removal is a swap with the last entry
+    size_t Index = 0;
 };
 
 class FCppObjectMapper final : public ICppObjectMapper
@@ -85,7 +88,29 @@ public:
     v8::Local<v8::FunctionTemplate> GetTemplateOfClass(v8::Isolate* Isolate, const JSClassDefinition* ClassDefinition);
 
 private:
-    std::unordered_map<void*, FObjectCacheNode, PointerHash, PointerEqual> CDataCache;
+    // direct mapped, a TypeId only evicts the one sharing its slot
+    struct FTypeCacheEntry
+    {
+        const void* TypeId = nullptr;
+        const JSClassDefinition* ClassDefinition = nullptr;
+        v8::UniquePersistent<v8::ObjectTemplate> InstanceTemplate;
+    };
+
+    static constexpr int TypeCacheBits = 6;
+
+    static constexpr size_t TypeCacheSize = 1 << TypeCacheBits;
+
+    static size_t TypeCacheIndex(const void* TypeId)
+    {
+        uint64_t Hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(TypeId)) * 0x9E3779B97F4A7C15ull;
+        return static_cast<size_t>(Hash >> (64 - TypeCacheBits));
+    }
+
+    TPointerHashMap<FObjectCacheList> CDataCache;
+
+    // classes recently pushed to script, saves the TypeIdToTemplateMap lookup when creating objects,
+    // an entry is only used while its ClassDefinition is still the registered one
+    FTypeCacheEntry TypeCache[TypeCacheSize];
 
     std::unordered_map<const void*, v8::UniquePersistent<v8::FunctionTemplate>, PointerHash, PointerEqual> TypeIdToTemplateMap;
 
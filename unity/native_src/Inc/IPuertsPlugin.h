@@ -25,6 +25,12 @@ public:
     virtual void* Eval(const char *Code, const char* Path) = 0;
 
     virtual bool ClearModuleCache(const char* Path) = 0;
+
+    virtual void SetModuleCodeCacheDir(const char* Dir) = 0;
+
+    virtual bool SetModuleCodeCacheBundle(const char* Path) = 0;
+
+    virtual void GetModuleCodeCacheStats(int32_t* Hits, int32_t* Misses, int32_t* Rejected) = 0;
     
     virtual int RegisterClass(int BaseTypeId, const char *FullName, FuncPtr Constructor, FuncPtr Destructor, int64_t Data, int Size) = 0;
     
@@ -84,6 +90,8 @@ public:
 
     virtual void SetArrayBufferToOutValue(void* Value, unsigned char *Bytes, int Length) = 0;
 
+    virtual void SetExternalArrayBufferToOutValue(void* Value, void* Data, int Length, FuncPtr Release, void* UserData) = 0;
+
     virtual void *GetObjectFromValue(void* Value, int IsOut) = 0;
 
     virtual int GetTypeIdFromValue(void* Value, int IsOut) = 0;
@@ -114,6 +122,8 @@ public:
 
     virtual void ReturnArrayBuffer(const void* Info, unsigned char *Bytes, int Length) = 0;
 
+    virtual void ReturnExternalArrayBuffer(const void* Info, void* Data, int Length, FuncPtr Release, void* UserData) = 0;
+
     virtual void ReturnBoolean(const void* Info, int Bool) = 0;
 
     virtual void ReturnDate(const void* Info, double Date) = 0;
@@ -141,6 +151,8 @@ public:
 
     virtual void PushArrayBufferForJSFunction(void* Function, unsigned char * Bytes, int Length) = 0;
 
+    virtual void PushExternalArrayBufferForJSFunction(void* Function, void* Data, int Length, FuncPtr Release, void* UserData) = 0;
+
     virtual void PushStringForJSFunction(void* Function, const char* S) = 0;
 
     virtual void PushNumberForJSFunction(void* Function, double D) = 0;
@@ -153,6 +165,8 @@ public:
 
     virtual void* InvokeJSFunction(void* Function, int HasResult) = 0;
 
+    virtual void* InvokeJSFunctionWithArguments(void* Function, const FArgumentValue* Arguments, int ArgumentCount, const void* Buffer, int HasResult) = 0;
+
     virtual JsValueType GetResultType(void* ResultInfo) = 0;
 
     virtual double GetNumberFromResult(void* ResultInfo) = 0;
@@ -18,6 +18,8 @@
 #include "JSFunction.h"
 #include "V8InspectorImpl.h"
 #include "BackendEnv.h"
+#include "PointerHashMap.h"
+#include "StructPool.h"
 #ifdef MULT_BACKENDS
 #include "IPuertsPlugin.h"
 #endif
@@ -55,6 +57,9 @@ typedef void (*JsFunctionFinalizeCallback)(v8::Isolate* Isolate, int64_t UserDat
 
 typedef void(*CSharpDestructorCallback)(void* Self, int64_t UserData);
 
+// called from JSEngine::LogicTick/LowMemoryNotification once the last reference to the buffer is gone
+typedef void(*CSharpArrayBufferReleaseCallback)(void* Data, void* UserData);
+
 struct FCallbackInfo
 {
     FCallbackInfo(bool InIsStatic, CSharpFunctionCallback InCallback, int64_t InData) : IsStatic(InIsStatic), Callback(InCallback), Data(InData) {}
@@ -71,6 +76,8 @@ struct FCallbackInfoWithFinalize : public FCallbackInfo
     JsFunctionFinalizeCallback Finalize;
     class JSEngine* JSE;
     v8::Global<v8::Function> JsFunction;
+    // position in JSEngine::CallbackWithFinalizeInfos, kept up to date so removal is a swap with the last entry
+    size_t Index = 0;
 };
 
 struct FLifeCycleInfo
@@ -86,6 +93,12 @@ struct FLifeCycleInfo
 
 v8::Local<v8::ArrayBuffer> NewArrayBuffer(v8::Isolate* Isolate, void *Ptr, size_t Size);
 
+// wrap caller owned memory without copying, Release is called when js no longer references it
+v8::Local<v8::ArrayBuffer> NewExternalArrayBuffer(v8::Isolate* Isolate, void *Ptr, size_t Size, CSharpArrayBufferReleaseCallback Release, void* UserData);
+
+// run the release callbacks of external buffers v8 has dropped, must be called where calling into c# is allowed
+void FlushArrayBufferReleases();
+
 enum JSEngineBackend
 {
     V8          = 0,
@@ -191,10 +204,26 @@ private:
 
     std::map<std::string, int> NameToTemplateID;
 
-    std::map<void*, v8::UniquePersistent<v8::Value>> ObjectMap;
+    TPointerHashMap<v8::UniquePersistent<v8::Value>> ObjectMap;
+
+    // storage of value types copied into js objects (FLifeCycleInfo::Size > 0)
+    FStructPool StructPool;
 
     std::vector<JSFunction*> JSFunctions;
 
+    // bumped when a slot is released, so a stale id stored on a js function never aliases a reused slot
+    std::vector<uint32_t> JSFunctionGenerations;
+
+    std::vector<int32_t> JSFunctionFreeIndex;
+
+#if !WITH_QUICKJS
+    v8::Global<v8::Private> FunctionIndexKey;
+#endif
+
+    v8::MaybeLocal<v8::Value> GetFunctionIndex(v8::Local<v8::Context> Context, v8::Local<v8::Function> Function);
+
+    void SetFunctionIndex(v8::Local<v8::Context> Context, v8::Local<v8::Function> Function, uint64_t Handle);
+
     v8::UniquePersistent<v8::Map> JSObjectIdMap;
 
     std::map<int32_t, JSObject*> JSObjectMap;
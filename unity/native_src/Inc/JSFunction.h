@@ -79,6 +79,8 @@ public:
 
     bool Invoke(bool HasResult);
 
+    bool Invoke(const puerts::FArgumentValue* Args, int ArgCount, const void* Buffer, bool HasResult);
+
     std::vector<FValue> Arguments;
 
     v8::UniquePersistent<v8::Function> GFunction;
@@ -88,5 +90,8 @@ public:
     v8::UniquePersistent<v8::Value> LastException;
 
     int32_t Index;
+
+private:
+    bool Call(v8::Isolate* Isolate, v8::Local<v8::Context> Context, int Argc, v8::Local<v8::Value>* Argv, bool HasResult);
 };
 }
\ No newline at end of file
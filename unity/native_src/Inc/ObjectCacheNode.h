@@ -16,119 +16,170 @@ PRAGMA_DISABLE_UNDEFINED_IDENTIFIER_WARNINGS
 #pragma warning(pop)
 PRAGMA_ENABLE_UNDEFINED_IDENTIFIER_WARNINGS
 
+#include <vector>
+
 namespace PUERTS_NAMESPACE
 {
+// the js object bound to a native pointer for one TypeId
 class FObjectCacheNode
 {
 public:
-    V8_INLINE FObjectCacheNode(const void* TypeId_) : TypeId(TypeId_), UserData(nullptr), Next(nullptr), MustCallFinalize(false)
+    V8_INLINE FObjectCacheNode() : FObjectCacheNode(nullptr)
     {
     }
 
-    V8_INLINE FObjectCacheNode(const void* TypeId_, FObjectCacheNode* Next_)
-        : TypeId(TypeId_), UserData(nullptr), Next(Next_), MustCallFinalize(false)
+    V8_INLINE FObjectCacheNode(const void* TypeId_) : TypeId(TypeId_), UserData(nullptr), MustCallFinalize(false)
     {
     }
 
     V8_INLINE FObjectCacheNode(FObjectCacheNode&& other) noexcept
-        : TypeId(other.TypeId)
-        , UserData(other.UserData)
-        , Next(other.Next)
-        , Value(std::move(other.Value))
-        , MustCallFinalize(other.MustCallFinalize)
+        : TypeId(other.TypeId), UserData(other.UserData), Value(std::move(other.Value)), MustCallFinalize(other.MustCallFinalize)
     {
         other.TypeId = nullptr;
         other.UserData = nullptr;
-        other.Next = nullptr;
         other.MustCallFinalize = false;
     }
 
     V8_INLINE FObjectCacheNode& operator=(FObjectCacheNode&& rhs) noexcept
     {
         TypeId = rhs.TypeId;
-        Next = rhs.Next;
         Value = std::move(rhs.Value);
         UserData = rhs.UserData;
         MustCallFinalize = rhs.MustCallFinalize;
         rhs.UserData = nullptr;
         rhs.TypeId = nullptr;
-        rhs.Next = nullptr;
         rhs.MustCallFinalize = false;
         return *this;
     }
 
-    ~FObjectCacheNode()
+    const void* TypeId;
+
+    void* UserData;
+
+    v8::UniquePersistent<v8::Value> Value;
+
+    bool MustCallFinalize;
+
+    FObjectCacheNode(const FObjectCacheNode&) = delete;
+    void operator=(const FObjectCacheNode&) = delete;
+};
+
+// All the js objects bound to one native pointer. Nearly always one type, sometimes two (e.g. a struct and its
+// first member), so two nodes are stored inline and only further ones go to the heap.
+// Nodes move on Add/Remove, do not keep a FObjectCacheNode* across those calls.
+class FObjectCacheList
+{
+public:
+    V8_INLINE FObjectCacheList() : Num(0)
     {
-        if (Next)
-            delete Next;
     }
 
-    FObjectCacheNode* Find(const void* TypeId_)
+    V8_INLINE FObjectCacheList(FObjectCacheList&& other) noexcept
+        : Num(other.Num), Overflow(std::move(other.Overflow))
     {
-        if (TypeId_ == TypeId)
+        for (size_t i = 0; i < InlineCount; ++i)
         {
-            return this;
+            Inline[i] = std::move(other.Inline[i]);
         }
-        if (Next)
+        other.Num = 0;
+        other.Overflow.clear();
+    }
+
+    V8_INLINE FObjectCacheList& operator=(FObjectCacheList&& rhs) noexcept
+    {
+        for (size_t i = 0; i < InlineCount; ++i)
         {
-            return Next->Find(TypeId_);
+            Inline[i] = std::move(rhs.Inline[i]);
+        }
+        Overflow = std::move(rhs.Overflow);
+        Num = rhs.Num;
+        rhs.Num = 0;
+        rhs.Overflow.clear();
+        return *this;
+    }
+
+    V8_INLINE FObjectCacheNode* Find(const void* TypeId)
+    {
+        for (size_t i = 0; i < Num; ++i)
+        {
+            FObjectCacheNode& Node = At(i);
+            if (Node.TypeId == TypeId)
+            {
+                return &Node;
+            }
         }
         return nullptr;
     }
 
-    FObjectCacheNode* Remove(const void* TypeId_, bool IsHead)
+    V8_INLINE FObjectCacheNode* Add(const void* TypeId)
     {
-        if (TypeId_ == TypeId)
+        if (Num < InlineCount)
         {
-            if (IsHead)
+            Inline[Num] = FObjectCacheNode(TypeId);
+        }
+        else
+        {
+            Overflow.emplace_back(TypeId);
+        }
+        return &At(Num++);
+    }
+
+    // the last node takes the place of the removed one
+    bool Remove(const void* TypeId)
+    {
+        for (size_t i = 0; i < Num; ++i)
+        {
+            if (At(i).TypeId == TypeId)
             {
-                if (Next)
+                --Num;
+                if (i != Num)
                 {
-                    auto PreNext = Next;
-                    *this = std::move(*Next);
-                    delete PreNext;
+                    At(i) = std::move(At(Num));
+                }
+                if (Num >= InlineCount)
+                {
+                    Overflow.pop_back();
                 }
                 else
                 {
-                    TypeId = nullptr;
-                    Next = nullptr;
-                    Value.Reset();
+                    Inline[Num] = FObjectCacheNode();
                 }
+                return true;
             }
-            return this;
-        }
-        if (Next)
-        {
-            auto Removed = Next->Remove(TypeId_, false);
-            if (Removed && Removed == Next)    // detach & delete by prev node
-            {
-                Next = Removed->Next;
-                Removed->Next = nullptr;
-                delete Removed;
-            }
-            return Removed;
         }
-        return nullptr;
+        return false;
     }
 
-    V8_INLINE FObjectCacheNode* Add(const void* TypeId_)
+    V8_INLINE bool IsEmpty() const
     {
-        Next = new FObjectCacheNode(TypeId_, Next);
-        return Next;
+        return Num == 0;
     }
 
-    const void* TypeId;
+    template <typename Func>
+    void ForEach(Func&& F)
+    {
+        for (size_t i = 0; i < Num; ++i)
+        {
+            F(At(i));
+        }
+    }
 
-    void* UserData;
+    FObjectCacheList(const FObjectCacheList&) = delete;
+    void operator=(const FObjectCacheList&) = delete;
 
-    FObjectCacheNode* Next;
+private:
+    static constexpr size_t InlineCount = 2;
 
-    v8::UniquePersistent<v8::Value> Value;
+    V8_INLINE FObjectCacheNode& At(size_t Index)
+    {
+        return Index < InlineCount ? Inline[Index] : Overflow[Index - InlineCount];
+    }
 
-    bool MustCallFinalize;
+    FObjectCacheNode Inline[InlineCount];
 
-    FObjectCacheNode(const FObjectCacheNode&) = delete;
-    void operator=(const FObjectCacheNode&) = delete;
+    size_t Num;
+
+    std::vector<FObjectCacheNode> Overflow;
 };
 
 }    // namespace PUERTS_NAMESPACE
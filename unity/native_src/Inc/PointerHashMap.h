@@ -0,0 +1,210 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+#include "NamespaceDef.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace PUERTS_NAMESPACE
+{
+// Open addressing map keyed by native pointer, linear probing in a power of two table.
+// nullptr marks an empty slot, so nullptr can not be used as a key.
+// Erase uses backward shift instead of tombstones, so heavy bind/unbind churn never degrades lookups.
+// Values may move on Emplace/operator[]/Erase, do not keep a V* across those calls.
+template <typename V>
+class TPointerHashMap
+{
+public:
+    TPointerHashMap() : Count(0), Mask(0)
+    {
+    }
+
+    TPointerHashMap(const TPointerHashMap&) = delete;
+    TPointerHashMap& operator=(const TPointerHashMap&) = delete;
+
+    V* Find(const void* Key)
+    {
+        if (Count == 0 || !Key)
+        {
+            return nullptr;
+        }
+        for (size_t Index = HomeIndex(Key);; Index = (Index + 1) & Mask)
+        {
+            FSlot& Slot = Slots[Index];
+            if (Slot.Key == Key)
+            {
+                return &Slot.Value;
+            }
+            if (!Slot.Key)
+            {
+                return nullptr;
+            }
+        }
+    }
+
+    // insert Value if Key is absent, returns the stored value and whether it was inserted
+    std::pair<V*, bool> Emplace(void* Key, V&& Value)
+    {
+        size_t Index;
+        if (FindSlot(Key, Index))
+        {
+            return {&Slots[Index].Value, false};
+        }
+        Slots[Index].Key = Key;
+        Slots[Index].Value = std::move(Value);
+        ++Count;
+        return {&Slots[Index].Value, true};
+    }
+
+    V& operator[](void* Key)
+    {
+        size_t Index;
+        if (!FindSlot(Key, Index))
+        {
+            Slots[Index].Key = Key;
+            ++Count;
+        }
+        return Slots[Index].Value;
+    }
+
+    bool Erase(const void* Key)
+    {
+        if (Count == 0 || !Key)
+        {
+            return false;
+        }
+        size_t Hole = HomeIndex(Key);
+        while (Slots[Hole].Key != Key)
+        {
+            if (!Slots[Hole].Key)
+            {
+                return false;
+            }
+            Hole = (Hole + 1) & Mask;
+        }
+        ResetValue(Slots[Hole].Value);
+
+        // pull back every entry of the following cluster whose home is not between the hole and itself
+        for (size_t Index = (Hole + 1) & Mask; Slots[Index].Key; Index = (Index + 1) & Mask)
+        {
+            size_t Home = HomeIndex(Slots[Index].Key);
+            if (((Index - Home) & Mask) >= ((Index - Hole) & Mask))
+            {
+                Slots[Hole].Key = Slots[Index].Key;
+                Slots[Hole].Value = std::move(Slots[Index].Value);
+                Hole = Index;
+            }
+        }
+        Slots[Hole].Key = nullptr;
+        ResetValue(Slots[Hole].Value);
+        --Count;
+        return true;
+    }
+
+    template <typename Func>
+    void ForEach(Func&& F)
+    {
+        for (auto& Slot : Slots)
+        {
+            if (Slot.Key)
+            {
+                F(Slot.Key, Slot.Value);
+            }
+        }
+    }
+
+    void Clear()
+    {
+        std::vector<FSlot>().swap(Slots);
+        Count = 0;
+        Mask = 0;
+    }
+
+    size_t Size() const
+    {
+        return Count;
+    }
+
+private:
+    struct FSlot
+    {
+        void* Key = nullptr;
+        V Value;
+    };
+
+    static constexpr size_t InitialCapacity = 64;
+
+    size_t HomeIndex(const void* Key) const
+    {
+        // pointers are aligned and clustered, fibonacci hashing spreads the low bits
+        uint64_t Hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(Key)) * 0x9E3779B97F4A7C15ull;
+        return static_cast<size_t>(Hash ^ (Hash >> 32)) & Mask;
+    }
+
+    static void ResetValue(V& Value)
+    {
+        Value.~V();
+        new (&Value) V();
+    }
+
+    // returns true if Key exists, otherwise Index is the empty slot to insert at
+    bool FindSlot(const void* Key, size_t& Index)
+    {
+        // keep load factor under 3/4
+        if ((Count + 1) * 4 > Slots.size() * 3)
+        {
+            Grow();
+        }
+        for (Index = HomeIndex(Key);; Index = (Index + 1) & Mask)
+        {
+            if (Slots[Index].Key == Key)
+            {
+                return true;
+            }
+            if (!Slots[Index].Key)
+            {
+                return false;
+            }
+        }
+    }
+
+    void Grow()
+    {
+        std::vector<FSlot> Old;
+        Old.swap(Slots);
+        size_t Capacity = Old.empty() ? InitialCapacity : Old.size() * 2;
+        Slots.resize(Capacity);
+        Mask = Capacity - 1;
+        for (auto& Slot : Old)
+        {
+            if (Slot.Key)
+            {
+                size_t Index = HomeIndex(Slot.Key);
+                while (Slots[Index].Key)
+                {
+                    Index = (Index + 1) & Mask;
+                }
+                Slots[Index].Key = Slot.Key;
+                Slots[Index].Value = std::move(Slot.Value);
+            }
+        }
+    }
+
+    std::vector<FSlot> Slots;
+
+    size_t Count;
+
+    size_t Mask;
+};
+}    // namespace PUERTS_NAMESPACE
@@ -0,0 +1,105 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+#include "NamespaceDef.h"
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <vector>
+
+namespace PUERTS_NAMESPACE
+{
+// Size classed slab pool for the copies of boxed value types (Vector3, Quaternion...) held by js objects.
+// Blocks are recycled through per class free lists and slabs are only released with the pool,
+// so the hot bind/unbind path never reaches the system allocator. Not thread safe, it is owned by
+// a JSEngine and only used while its isolate is locked.
+class FStructPool
+{
+public:
+    FStructPool() : FreeLists()
+    {
+    }
+
+    FStructPool(const FStructPool&) = delete;
+    FStructPool& operator=(const FStructPool&) = delete;
+
+    ~FStructPool()
+    {
+        for (auto Slab : Slabs)
+        {
+            ::free(Slab);
+        }
+    }
+
+    void* Alloc(size_t Size)
+    {
+        if (Size == 0 || Size > MaxPooledSize)
+        {
+            return ::malloc(Size);
+        }
+        size_t ClassIndex = (Size - 1) / Granularity;
+        FFreeBlock* Block = FreeLists[ClassIndex];
+        if (!Block)
+        {
+            Block = Refill(ClassIndex);
+        }
+        FreeLists[ClassIndex] = Block->Next;
+        return Block;
+    }
+
+    void Free(void* Ptr, size_t Size)
+    {
+        if (Size == 0 || Size > MaxPooledSize)
+        {
+            ::free(Ptr);
+            return;
+        }
+        size_t ClassIndex = (Size - 1) / Granularity;
+        FFreeBlock* Block = static_cast<FFreeBlock*>(Ptr);
+        Block->Next = FreeLists[ClassIndex];
+        FreeLists[ClassIndex] = Block;
+    }
+
+private:
+    struct FFreeBlock
+    {
+        FFreeBlock* Next;
+    };
+
+    // 16 byte steps keep every block aligned for SetAlignedPointerInInternalField and SIMD types
+    static constexpr size_t Granularity = 16;
+
+    static constexpr size_t MaxPooledSize = 256;
+
+    static constexpr size_t ClassCount = MaxPooledSize / Granularity;
+
+    static constexpr size_t SlabSize = 64 * 1024;
+
+    FFreeBlock* Refill(size_t ClassIndex)
+    {
+        size_t BlockSize = (ClassIndex + 1) * Granularity;
+        char* Slab = static_cast<char*>(::malloc(SlabSize));
+        Slabs.push_back(Slab);
+        FFreeBlock* Head = nullptr;
+        for (size_t Offset = (SlabSize / BlockSize) * BlockSize; Offset > 0;)
+        {
+            Offset -= BlockSize;
+            FFreeBlock* Block = reinterpret_cast<FFreeBlock*>(Slab + Offset);
+            Block->Next = Head;
+            Head = Block;
+        }
+        return Head;
+    }
+
+    FFreeBlock* FreeLists[ClassCount];
+
+    std::vector<char*> Slabs;
+};
+}    // namespace PUERTS_NAMESPACE
@@ -8,6 +8,9 @@
 #include "Log.h"
 #include "PromiseRejectCallback.hpp"
 #include "V8Utils.h"
+#include "CodeCacheBundle.h"
+#include <cstdio>
+#include <memory>
 
 #if WITH_NODEJS
 
@@ -386,6 +389,9 @@ void FBackendEnv::UnInitialize()
     //     *static_cast<bool*>(data) = true;
     // }, &platform_finished);
     Platform->UnregisterIsolate(MainIsolate);
+#endif
+#if !defined(WITH_QUICKJS)
+    PendingCodeCaches.clear();
 #endif
     MainContext.Reset();
     MainIsolate->Dispose();
@@ -507,6 +513,49 @@ bool FBackendEnv::ClearModuleCache(v8::Isolate* Isolate, v8::Local<v8::Context>
     return false;
 }
 
+void FBackendEnv::SetCodeCacheDir(const char* Dir)
+{
+    CodeCacheDir = Dir == nullptr ? "" : Dir;
+    if (!CodeCacheDir.empty() && CodeCacheDir.back() != '/' && CodeCacheDir.back() != '\\')
+    {
+        CodeCacheDir.push_back('/');
+    }
+}
+
+bool FBackendEnv::SetCodeCacheBundle(const char* Path)
+{
+    std::vector<uint8_t>().swap(CodeCacheBundle);
+#if defined(WITH_QUICKJS)
+    return false;
+#else
+    if (Path == nullptr || *Path == '\0')
+    {
+        return false;
+    }
+    FILE* File = fopen(Path, "rb");
+    if (!File)
+    {
+        return false;
+    }
+    std::vector<uint8_t> Bundle;
+    bool Valid = fseek(File, 0, SEEK_END) == 0;
+    long Size = Valid ? ftell(File) : -1;
+    if (Size > 0 && fseek(File, 0, SEEK_SET) == 0)
+    {
+        Bundle.resize(static_cast<size_t>(Size));
+        Valid = fread(Bundle.data(), 1, Bundle.size(), File) == Bundle.size();
+    }
+    fclose(File);
+    if (!Valid || !IsValidCodeCacheBundle(Bundle.data(), Bundle.size(), v8::ScriptCompiler::CachedDataVersionTag()))
+    {
+        PLog(Warning, "code cache bundle %s is invalid or was built for another v8 version or flags", Path);
+        return false;
+    }
+    CodeCacheBundle.swap(Bundle);
+    return true;
+#endif
+}
+
 #if defined(WITH_QUICKJS)
 char* FBackendEnv::ResolveQjsModule(JSContext *ctx, const char *base_name, const char *name, bool throwIfFail)
 {
@@ -745,6 +794,95 @@ v8::MaybeLocal<v8::Value> FBackendEnv::ReadFile(
     return maybeRet;
 }
 
+struct FModuleCodeCacheHeader
+{
+    uint32_t MagicNumber;
+    uint32_t VersionTag;    // v8::ScriptCompiler::CachedDataVersionTag(), covers v8 version and flags
+    uint64_t SourceHash;
+    uint32_t PayloadLength;
+    uint32_t Reserved;
+};
+
+static constexpr uint32_t kModuleCodeCacheMagic = 0x43434D50;    // "PMCC"
+
+// FNV-1a, stable across runs and platforms
+static uint64_t HashBytes(const char* Data, size_t Length)
+{
+    uint64_t Hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < Length; ++i)
+    {
+        Hash ^= static_cast<uint8_t>(Data[i]);
+        Hash *= 1099511628211ULL;
+    }
+    return Hash;
+}
+
+v8::ScriptCompiler::CachedData* FBackendEnv::LoadCodeCache(const std::string& CacheFile, uint64_t SourceHash)
+{
+    FILE* File = fopen(CacheFile.c_str(), "rb");
+    if (!File)
+    {
+        ++CodeCacheMisses;
+        return nullptr;
+    }
+    FModuleCodeCacheHeader Header;
+    uint8_t* Payload = nullptr;
+    bool Valid = fread(&Header, sizeof(Header), 1, File) == 1 && Header.MagicNumber == kModuleCodeCacheMagic &&
+        Header.VersionTag == v8::ScriptCompiler::CachedDataVersionTag() && Header.SourceHash == SourceHash &&
+        Header.PayloadLength > 0;
+    if (Valid)
+    {
+        Payload = new uint8_t[Header.PayloadLength];
+        Valid = fread(Payload, 1, Header.PayloadLength, File) == Header.PayloadLength;
+    }
+    fclose(File);
+    if (!Valid)
+    {
+        delete[] Payload;
+        ++CodeCacheRejected;
+        return nullptr;
+    }
+    return new v8::ScriptCompiler::CachedData(
+        Payload, static_cast<int>(Header.PayloadLength), v8::ScriptCompiler::CachedData::BufferOwned);
+}
+
+void FBackendEnv::SaveCodeCaches(v8::Isolate* Isolate)
+{
+    for (auto& Pending : PendingCodeCaches)
+    {
+        v8::Local<v8::Module> Module = Pending.Module.Get(Isolate);
+        // GetUnboundModuleScript is only allowed before evaluation starts
+        auto Status = Module->GetStatus();
+        if (Status == v8::Module::kEvaluating || Status == v8::Module::kEvaluated || Status == v8::Module::kErrored)
+        {
+            continue;
+        }
+        std::unique_ptr<v8::ScriptCompiler::CachedData> CachedData(
+            v8::ScriptCompiler::CreateCodeCache(Module->GetUnboundModuleScript()));
+        if (!CachedData || CachedData->length <= 0)
+        {
+            continue;
+        }
+        FModuleCodeCacheHeader Header = {kModuleCodeCacheMagic, v8::ScriptCompiler::CachedDataVersionTag(), Pending.SourceHash,
+            static_cast<uint32_t>(CachedData->length), 0};
+        FILE* File = fopen(Pending.CacheFile.c_str(), "wb");
+        if (!File)
+        {
+            PLog(Warning, "can not write code cache to %s", Pending.CacheFile.c_str());
+            continue;
+        }
+        fwrite(&Header, sizeof(Header), 1, File);
+        fwrite(CachedData->data, 1, CachedData->length, File);
+        fclose(File);
+    }
+    PendingCodeCaches.clear();
+}
+
+void FBackendEnv::DiscardCodeCaches()
+{
+    PendingCodeCaches.clear();
+}
+
 v8::MaybeLocal<v8::Module> FBackendEnv::FetchModuleTree(v8::Isolate* isolate, v8::Local<v8::Context> context,
     v8::Local<v8::String> absolute_file_path)
 {
@@ -780,12 +918,63 @@ v8::MaybeLocal<v8::Module> FBackendEnv::FetchModuleTree(v8::Isolate* isolate, v8
     v8::ScriptOrigin origin(script_url, v8::Integer::New(isolate, 0), v8::Integer::New(isolate, 0), v8::True(isolate),
         v8::Local<v8::Integer>(), v8::Local<v8::Value>(), v8::False(isolate), v8::False(isolate), v8::True(isolate));
 #endif
-    v8::ScriptCompiler::Source source(source_text.As<v8::String>(), origin);
+    v8::ScriptCompiler::CachedData* cached_data = nullptr;
+    uint64_t source_hash = 0;
+    std::string cache_file;
+    if (!CodeCacheBundle.empty() || !CodeCacheDir.empty())
+    {
+        v8::String::Utf8Value source_utf8(isolate, source_text);
+        source_hash = HashBytes(*source_utf8, source_utf8.length());
+    }
+    if (!CodeCacheBundle.empty())
+    {
+        const CodeCacheBundleEntry* Entry = FindCodeCacheBundleEntry(CodeCacheBundle.data(), CodeCacheBundle.size(),
+            v8::ScriptCompiler::CachedDataVersionTag(), absolute_file_path_str.data(), absolute_file_path_str.size());
+        if (Entry && (Entry->Flags & kCodeCacheBundleModule) && Entry->SourceHash == source_hash)
+        {
+            // the bundle outlives the compile, v8 copies what it keeps
+            cached_data = new v8::ScriptCompiler::CachedData(CodeCacheBundle.data() + Entry->PayloadOffset,
+                static_cast<int>(Entry->PayloadLength), v8::ScriptCompiler::CachedData::BufferNotOwned);
+        }
+        else if (CodeCacheDir.empty())
+        {
+            ++CodeCacheMisses;
+        }
+    }
+    if (!CodeCacheDir.empty())
+    {
+        char cache_name[32];
+        snprintf(cache_name, sizeof(cache_name), "%016llx.jscache",
+            static_cast<unsigned long long>(HashBytes(absolute_file_path_str.data(), absolute_file_path_str.size())));
+        cache_file = CodeCacheDir + cache_name;
+        if (!cached_data)
+        {
+            cached_data = LoadCodeCache(cache_file, source_hash);
+        }
+    }
+    v8::ScriptCompiler::Source source(source_text.As<v8::String>(), origin, cached_data);    // cached_data deleted by ~Source
     v8::Local<v8::Module> module;
-    if (!v8::ScriptCompiler::CompileModule(isolate, &source).ToLocal(&module))
+    if (!v8::ScriptCompiler::CompileModule(isolate, &source,
+            cached_data ? v8::ScriptCompiler::kConsumeCodeCache : v8::ScriptCompiler::kNoCompileOptions)
+             .ToLocal(&module))
     {
         return v8::MaybeLocal<v8::Module>();
     }
+    if (cached_data && !source.GetCachedData()->rejected)
+    {
+        ++CodeCacheHits;
+    }
+    else
+    {
+        if (cached_data)
+        {
+            ++CodeCacheRejected;
+        }
+        if (!cache_file.empty())
+        {
+            PendingCodeCaches.push_back({cache_file, source_hash, v8::Global<v8::Module>(isolate, module)});
+        }
+    }
 
     FModuleInfo* info = new FModuleInfo;
     info->Module.Reset(isolate, module);
@@ -912,14 +1101,20 @@ void esmodule::ExecuteModule(const v8::FunctionCallbackInfo<v8::Value>& info)
 
     if (!backend_env->FetchModuleTree(isolate, context, resolved_path.As<v8::String>()).ToLocal(&root_module))
     {
+        backend_env->DiscardCodeCaches();
         return;
     }
     
     v8::MaybeLocal<v8::Value> maybe_result;
     if (root_module->InstantiateModule(context, FBackendEnv::ResolveModuleCallback).FromMaybe(false))
     {
+        backend_env->SaveCodeCaches(isolate);
         maybe_result = root_module->Evaluate(context);
     }
+    else
+    {
+        backend_env->DiscardCodeCaches();
+    }
     
     v8::Local<v8::Value> result;
     if (!maybe_result.ToLocal(&result))
@@ -1036,6 +1231,7 @@ static void DoHostImportModuleDynamically(void* import_data_)
     }
     else if(!backend_env->FetchModuleTree(isolate, context, resolved_path.As<v8::String>()).ToLocal(&root_module))
     {
+        backend_env->DiscardCodeCaches();
         resolver->Reject(context, try_catch.Exception());
         return;
     }
@@ -1043,8 +1239,13 @@ static void DoHostImportModuleDynamically(void* import_data_)
     v8::MaybeLocal<v8::Value> maybe_result;
     if (root_module->InstantiateModule(context, FBackendEnv::ResolveModuleCallback).FromMaybe(false))
     {
+        backend_env->SaveCodeCaches(isolate);
         maybe_result = root_module->Evaluate(context);
     }
+    else
+    {
+        backend_env->DiscardCodeCaches();
+    }
     
     v8::Local<v8::Value> result;
     if (!maybe_result.ToLocal(&result))
@@ -86,10 +86,10 @@ v8::Local<v8::Value> FCppObjectMapper::FindOrAddCppObject(
 
     if (PassByPointer)
     {
-        auto Iter = CDataCache.find(Ptr);
-        if (Iter != CDataCache.end())
+        auto Objects = CDataCache.Find(Ptr);
+        if (Objects)
         {
-            auto CacheNodePtr = Iter->second.Find(TypeId);
+            auto CacheNodePtr = Objects->Find(TypeId);
             if (CacheNodePtr)
             {
                 return CacheNodePtr->Value.Get(Isolate);
@@ -98,20 +98,25 @@ v8::Local<v8::Value> FCppObjectMapper::FindOrAddCppObject(
     }
 
     // create and link
-    auto ClassDefinition = LoadClassByID(TypeId);
-    if (ClassDefinition)
-    {
-        auto Result = GetTemplateOfClass(Isolate, ClassDefinition)->InstanceTemplate()->NewInstance(Context).ToLocalChecked();
-        BindCppObject(Isolate, const_cast<JSClassDefinition*>(ClassDefinition), Ptr, Result, PassByPointer);
-        return Result;
-    }
-    else
+    FTypeCacheEntry& TypeEntry = TypeCache[TypeCacheIndex(TypeId)];
+    // a re-registered class gets a new definition, FindClassByID is a lock free table read
+    if (TypeEntry.TypeId != TypeId || TypeEntry.ClassDefinition != FindClassByID(TypeId))
     {
-        auto Result = PointerTemplate.Get(Isolate)->InstanceTemplate()->NewInstance(Context).ToLocalChecked();
-        DataTransfer::SetPointer(Isolate, Result, Ptr, 0);
-        DataTransfer::SetPointer(Isolate, Result, TypeId, 1);
-        return Result;
+        auto ClassDefinition = LoadClassByID(TypeId);
+        if (!ClassDefinition)
+        {
+            auto Result = PointerTemplate.Get(Isolate)->InstanceTemplate()->NewInstance(Context).ToLocalChecked();
+            DataTransfer::SetPointer(Isolate, Result, Ptr, 0);
+            DataTransfer::SetPointer(Isolate, Result, TypeId, 1);
+            return Result;
+        }
+        TypeEntry.InstanceTemplate.Reset(Isolate, GetTemplateOfClass(Isolate, ClassDefinition)->InstanceTemplate());
+        TypeEntry.ClassDefinition = ClassDefinition;
+        TypeEntry.TypeId = TypeId;
     }
+    auto Result = TypeEntry.InstanceTemplate.Get(Isolate)->NewInstance(Context).ToLocalChecked();
+    BindCppObject(Isolate, const_cast<JSClassDefinition*>(TypeEntry.ClassDefinition), Ptr, Result, PassByPointer);
+    return Result;
 }
 
 static void PesapiFunctionCallback(const v8::FunctionCallbackInfo<v8::Value>& info)
@@ -127,17 +132,11 @@ void FCppObjectMapper::CallbackDataGarbageCollected(const v8::WeakCallbackInfo<P
     {
         CallbackData->Finalize(&v8impl::g_pesapi_ffi, CallbackData->Data, DataTransfer::GetIsolatePrivateData(Data.GetIsolate()));
     }
-    for (auto it = CallbackData->CppObjectMapper->FunctionDatas.begin(); it != CallbackData->CppObjectMapper->FunctionDatas.end(); )
-    {
-        if (*it == CallbackData)
-        {
-            it = CallbackData->CppObjectMapper->FunctionDatas.erase(it);
-        }
-        else
-        {
-            ++it;
-        }
-    }
+    auto& FunctionDatas = CallbackData->CppObjectMapper->FunctionDatas;
+    PesapiCallbackData* Last = FunctionDatas.back();
+    FunctionDatas[CallbackData->Index] = Last;
+    Last->Index = CallbackData->Index;
+    FunctionDatas.pop_back();
     delete CallbackData;
 }
 
@@ -155,6 +154,7 @@ v8::MaybeLocal<v8::Function> FCppObjectMapper::CreateFunction(v8::Local<v8::Cont
         CallbackData->JsFunction.Reset(Isolate, Ret.ToLocalChecked());
         CallbackData->JsFunction.SetWeak<PesapiCallbackData>(
             CallbackData, CallbackDataGarbageCollected, v8::WeakCallbackType::kInternalFields);
+        CallbackData->Index = FunctionDatas.size();
         FunctionDatas.push_back(CallbackData);
     }
     else
@@ -369,17 +369,11 @@ void FCppObjectMapper::BindCppObject(
     DataTransfer::SetPointer(Isolate, JSObject, Ptr, 0);
     DataTransfer::SetPointer(Isolate, JSObject, ClassDefinition->TypeId, 1);
 
-    auto Iter = CDataCache.find(Ptr);
-    FObjectCacheNode* CacheNodePtr;
-    if (Iter != CDataCache.end())
+    FObjectCacheList& Objects = CDataCache[Ptr];
+    auto CacheNodePtr = Objects.Find(ClassDefinition->TypeId);
+    if (!CacheNodePtr)
     {
-        auto Temp = Iter->second.Find(ClassDefinition->TypeId);
-        CacheNodePtr = Temp ? Temp : Iter->second.Add(ClassDefinition->TypeId);
-    }
-    else
-    {
-        auto Ret = CDataCache.insert({Ptr, FObjectCacheNode(ClassDefinition->TypeId)});
-        CacheNodePtr = &Ret.first->second;
+        CacheNodePtr = Objects.Add(ClassDefinition->TypeId);
     }
     CacheNodePtr->Value.Reset(Isolate, JSObject);
 
@@ -397,7 +391,15 @@ void FCppObjectMapper::BindCppObject(
 
     if (ClassDefinition->OnEnter)
     {
-        CacheNodePtr->UserData = ClassDefinition->OnEnter(Ptr, ClassDefinition->Data, DataTransfer::GetIsolatePrivateData(Isolate));
+        void* UserData = ClassDefinition->OnEnter(Ptr, ClassDefinition->Data, DataTransfer::GetIsolatePrivateData(Isolate));
+        // OnEnter may bind other objects, which can rehash CDataCache or move the list's nodes, so look the node up again
+        if (auto ObjectsAfter = CDataCache.Find(Ptr))
+        {
+            if (auto NodeAfter = ObjectsAfter->Find(ClassDefinition->TypeId))
+            {
+                NodeAfter->UserData = UserData;
+            }
+        }
     }
 }
 
@@ -437,18 +439,25 @@ void FCppObjectMapper::SetPrivateData(v8::Local<v8::Context> Context, v8::Local<
 
 void FCppObjectMapper::UnBindCppObject(v8::Isolate* Isolate, JSClassDefinition* ClassDefinition, void* Ptr)
 {
-    auto Iter = CDataCache.find(Ptr);
-    if (Iter != CDataCache.end())
+    auto Objects = CDataCache.Find(Ptr);
+    if (Objects)
     {
         if (ClassDefinition->OnExit)
         {
-            ClassDefinition->OnExit(
-                Ptr, ClassDefinition->Data, DataTransfer::GetIsolatePrivateData(Isolate), Iter->second.UserData);
+            auto CacheNodePtr = Objects->Find(ClassDefinition->TypeId);
+            ClassDefinition->OnExit(Ptr, ClassDefinition->Data, DataTransfer::GetIsolatePrivateData(Isolate),
+                CacheNodePtr ? CacheNodePtr->UserData : nullptr);
+            // same as BindCppObject, OnExit may have changed CDataCache
+            Objects = CDataCache.Find(Ptr);
+            if (!Objects)
+            {
+                return;
+            }
         }
-        auto Removed = Iter->second.Remove(ClassDefinition->TypeId, true);
-        if (!Iter->second.TypeId)    // last one
+        Objects->Remove(ClassDefinition->TypeId);
+        if (Objects->IsEmpty())    // last one
         {
-            CDataCache.erase(Ptr);
+            CDataCache.Erase(Ptr);
         }
     }
 }
@@ -456,28 +465,26 @@ void FCppObjectMapper::UnBindCppObject(v8::Isolate* Isolate, JSClassDefinition*
 void FCppObjectMapper::UnInitialize(v8::Isolate* InIsolate)
 {
     auto PData = DataTransfer::GetIsolatePrivateData(InIsolate);
-    for (auto& KV : CDataCache)
+    CDataCache.ForEach([&](void* Ptr, FObjectCacheList& Objects)
     {
-        FObjectCacheNode* PNode = &KV.second;
-        while (PNode)
+        Objects.ForEach([&](FObjectCacheNode& Node)
         {
-            const JSClassDefinition* ClassDefinition = FindClassByID(PNode->TypeId);
-            if (PNode->MustCallFinalize)
+            const JSClassDefinition* ClassDefinition = FindClassByID(Node.TypeId);
+            if (Node.MustCallFinalize)
             {
                 if (ClassDefinition && ClassDefinition->Finalize)
                 {
-                    ClassDefinition->Finalize(&v8impl::g_pesapi_ffi, KV.first, ClassDefinition->Data, PData);
+                    ClassDefinition->Finalize(&v8impl::g_pesapi_ffi, Ptr, ClassDefinition->Data, PData);
                 }
-                PNode->MustCallFinalize = false;
+                Node.MustCallFinalize = false;
             }
             if (ClassDefinition->OnExit)
             {
                 ClassDefinition->OnExit(
-                    KV.first, ClassDefinition->Data, DataTransfer::GetIsolatePrivateData(InIsolate), PNode->UserData);
+                    Ptr, ClassDefinition->Data, DataTransfer::GetIsolatePrivateData(InIsolate), Node.UserData);
             }
-            PNode = PNode->Next;
-        }
-    }
+        });
+    });
     for(int i = 0;i < FunctionDatas.size(); ++i)
     {
         auto CallbackData = FunctionDatas[i];
@@ -488,7 +495,13 @@ void FCppObjectMapper::UnInitialize(v8::Isolate* InIsolate)
         delete CallbackData;
     }
     FunctionDatas.clear();
-    CDataCache.clear();
+    CDataCache.Clear();
+    for (auto& TypeEntry : TypeCache)
+    {
+        TypeEntry.TypeId = nullptr;
+        TypeEntry.ClassDefinition = nullptr;
+        TypeEntry.InstanceTemplate.Reset();
+    }
     TypeIdToTemplateMap.clear();
 #ifndef WITH_QUICKJS
     PrivateKey.Reset();
@@ -41,6 +41,58 @@ namespace PUERTS_NAMESPACE
         return Ab;
     }
 
+#if !WITH_QUICKJS
+    struct FExternalArrayBufferRelease
+    {
+        CSharpArrayBufferReleaseCallback Release;
+        void* UserData;
+        void* Data;
+    };
+
+    // the deleter may run on a v8 background thread, so it only queues the release for FlushArrayBufferReleases
+    static std::mutex PendingArrayBufferReleasesMutex;
+    static std::vector<FExternalArrayBufferRelease*> PendingArrayBufferReleases;
+
+    static void ExternalArrayBufferDeleter(void* Data, size_t Length, void* DeleterData)
+    {
+        auto ReleaseInfo = static_cast<FExternalArrayBufferRelease*>(DeleterData);
+        ReleaseInfo->Data = Data;
+        std::lock_guard<std::mutex> Guard(PendingArrayBufferReleasesMutex);
+        PendingArrayBufferReleases.push_back(ReleaseInfo);
+    }
+#endif
+
+    void FlushArrayBufferReleases()
+    {
+#if !WITH_QUICKJS
+        std::vector<FExternalArrayBufferRelease*> Releases;
+        {
+            std::lock_guard<std::mutex> Guard(PendingArrayBufferReleasesMutex);
+            Releases.swap(PendingArrayBufferReleases);
+        }
+        for (auto ReleaseInfo : Releases)
+        {
+            ReleaseInfo->Release(ReleaseInfo->Data, ReleaseInfo->UserData);
+            delete ReleaseInfo;
+        }
+#endif
+    }
+
+    v8::Local<v8::ArrayBuffer> NewExternalArrayBuffer(v8::Isolate* Isolate, void *Ptr, size_t Size, CSharpArrayBufferReleaseCallback Release, void* UserData)
+    {
+#if WITH_QUICKJS
+        // no external backing store in the quickjs backend, copy and release at once
+        auto Ab = NewArrayBuffer(Isolate, Ptr, Size);
+        if (Release) Release(Ptr, UserData);
+        return Ab;
+#else
+        auto Backing = Release
+            ? v8::ArrayBuffer::NewBackingStore(Ptr, Size, ExternalArrayBufferDeleter, new FExternalArrayBufferRelease{Release, UserData, Ptr})
+            : v8::ArrayBuffer::NewBackingStore(Ptr, Size, v8::BackingStore::EmptyDeleter, nullptr);
+        return v8::ArrayBuffer::New(Isolate, std::move(Backing));
+#endif
+    }
+
     static void EvalWithPath(const v8::FunctionCallbackInfo<v8::Value>& Info)
     {
         v8::Isolate* Isolate = Info.GetIsolate();
@@ -128,6 +180,9 @@ namespace PUERTS_NAMESPACE
         Global->Set(Context, FV8Utils::V8String(Isolate, "__tgjsEvalScript"), v8::FunctionTemplate::New(Isolate, &EvalWithPath)->GetFunction(Context).ToLocalChecked()).Check();
 
         JSObjectIdMap.Reset(Isolate, v8::Map::New(Isolate));
+#if !WITH_QUICKJS
+        FunctionIndexKey.Reset(Isolate, v8::Private::New(Isolate));
+#endif
 
         JSObjectValueGetter = CreateJSFunction(
             Isolate, Context, 
@@ -149,6 +204,9 @@ namespace PUERTS_NAMESPACE
         DestroyInspector();
 
         JSObjectIdMap.Reset();
+#if !WITH_QUICKJS
+        FunctionIndexKey.Reset();
+#endif
         BackendEnv.JsPromiseRejectCallback.Reset();
         LastException.Reset();
 
@@ -171,9 +229,9 @@ namespace PUERTS_NAMESPACE
             auto Context = ResultInfo.Context.Get(Isolate);
             v8::Context::Scope ContextScope(Context);
 
-            for (auto Iter = ObjectMap.begin(); Iter != ObjectMap.end(); ++Iter)
+            ObjectMap.ForEach([&](void* Key, v8::UniquePersistent<v8::Value>& Persistent)
             {
-                auto Value = Iter->second.Get(MainIsolate);
+                auto Value = Persistent.Get(MainIsolate);
                 if (Value->IsObject())
                 {
                     auto Object = Value->ToObject(Context).ToLocalChecked();
@@ -181,11 +239,12 @@ namespace PUERTS_NAMESPACE
                     if (LifeCycleInfo && LifeCycleInfo->Size > 0)
                     {
                         auto Ptr = FV8Utils::GetPoninter(Object);
-                        free(Ptr);
+                        StructPool.Free(Ptr, LifeCycleInfo->Size);
                     }
                 }
-                Iter->second.Reset();
-            }
+                Persistent.Reset();
+            });
+            ObjectMap.Clear();
             BackendEnv.PathToModuleMap.clear();
             BackendEnv.ScriptIdToPathMap.clear();
         }
@@ -226,6 +285,9 @@ namespace PUERTS_NAMESPACE
         {
             delete LifeCycleInfos[i];
         }
+
+        // the disposed isolate has dropped every external buffer it still held
+        FlushArrayBufferReleases();
     }
 
     JSFunction* JSEngine::GetModuleExecutor()
@@ -373,44 +435,77 @@ namespace PUERTS_NAMESPACE
         delete InObject;
     }
 
+    // generation in the high bits, kept below 2^53 so the id survives as a js number
+    static const uint32_t JS_FUNCTION_GENERATION_MASK = 0x1FFFFF;
+
+    // a private key keeps the id out of reach of js (Object.getOwnPropertySymbols, proxies)
+    v8::MaybeLocal<v8::Value> JSEngine::GetFunctionIndex(v8::Local<v8::Context> Context, v8::Local<v8::Function> Function)
+    {
+        v8::Isolate* Isolate = Context->GetIsolate();
+#if !WITH_QUICKJS
+        return Function->GetPrivate(Context, FunctionIndexKey.Get(Isolate));
+#else
+        return Function->Get(Context, FV8Utils::V8String(Isolate, FUNCTION_INDEX_KEY));
+#endif
+    }
+
+    void JSEngine::SetFunctionIndex(v8::Local<v8::Context> Context, v8::Local<v8::Function> Function, uint64_t Handle)
+    {
+        v8::Isolate* Isolate = Context->GetIsolate();
+        auto Id = v8::Number::New(Isolate, static_cast<double>(Handle));
+#if !WITH_QUICKJS
+        (void) Function->SetPrivate(Context, FunctionIndexKey.Get(Isolate), Id);
+#else
+        (void) Function->Set(Context, FV8Utils::V8String(Isolate, FUNCTION_INDEX_KEY), Id);
+#endif
+    }
+
     JSFunction* JSEngine::CreateJSFunction(v8::Isolate* InIsolate, v8::Local<v8::Context> InContext, v8::Local<v8::Function> InFunction)
     {
         std::lock_guard<std::mutex> guard(JSFunctionsMutex);
-        auto maybeId = InFunction->Get(InContext, FV8Utils::V8String(InIsolate, FUNCTION_INDEX_KEY));
-        if (!maybeId.IsEmpty()) {
-            auto id = maybeId.ToLocalChecked();
-            if (id->IsNumber()) {
-                int32_t index = id->Int32Value(InContext).ToChecked();
-                return JSFunctions[index];
+        v8::Local<v8::Value> Id;
+        if (GetFunctionIndex(InContext, InFunction).ToLocal(&Id) && Id->IsNumber())
+        {
+            uint64_t Handle = static_cast<uint64_t>(Id.As<v8::Number>()->Value());
+            uint32_t Index = static_cast<uint32_t>(Handle & 0xFFFFFFFF);
+            uint32_t Generation = static_cast<uint32_t>(Handle >> 32);
+            if (Index < JSFunctions.size() && JSFunctions[Index] && JSFunctionGenerations[Index] == Generation)
+            {
+                return JSFunctions[Index];
             }
         }
-        JSFunction* Function = nullptr;
-        for (int i = 0; i < JSFunctions.size(); i++) {
-            if (!JSFunctions[i]) {
-#ifdef MULT_BACKENDS
-                Function = new JSFunction(ResultInfo.PuertsPlugin, InIsolate, InContext, InFunction, i);
-#else
-                Function = new JSFunction(InIsolate, InContext, InFunction, i);
-#endif
-                JSFunctions[i] = Function;
-                break;
-            }
+
+        int32_t Index;
+        if (!JSFunctionFreeIndex.empty())
+        {
+            Index = JSFunctionFreeIndex.back();
+            JSFunctionFreeIndex.pop_back();
+        }
+        else
+        {
+            Index = static_cast<int32_t>(JSFunctions.size());
+            JSFunctions.push_back(nullptr);
+            JSFunctionGenerations.push_back(0);
         }
-        if (!Function) {
 #ifdef MULT_BACKENDS
-            Function = new JSFunction(ResultInfo.PuertsPlugin, InIsolate, InContext, InFunction, static_cast<int32_t>(JSFunctions.size()));
+        JSFunction* Function = new JSFunction(ResultInfo.PuertsPlugin, InIsolate, InContext, InFunction, Index);
 #else
-            Function = new JSFunction(InIsolate, InContext, InFunction, static_cast<int32_t>(JSFunctions.size()));
+        JSFunction* Function = new JSFunction(InIsolate, InContext, InFunction, Index);
 #endif
-            JSFunctions.push_back(Function);
-        }
-        InFunction->Set(InContext, FV8Utils::V8String(InIsolate, FUNCTION_INDEX_KEY), v8::Integer::New(InIsolate, Function->Index));
+        JSFunctions[Index] = Function;
+        uint64_t Handle = (static_cast<uint64_t>(JSFunctionGenerations[Index]) << 32) | static_cast<uint32_t>(Index);
+        SetFunctionIndex(InContext, InFunction, Handle);
         return Function;
     }
 
     void JSEngine::ReleaseJSFunction(JSFunction* InFunction)
     {
-        JSFunctions[InFunction->Index] = nullptr;
+        {
+            std::lock_guard<std::mutex> guard(JSFunctionsMutex);
+            JSFunctions[InFunction->Index] = nullptr;
+            JSFunctionGenerations[InFunction->Index] = (JSFunctionGenerations[InFunction->Index] + 1) & JS_FUNCTION_GENERATION_MASK;
+            JSFunctionFreeIndex.push_back(InFunction->Index);
+        }
         delete InFunction;
     }
 
@@ -456,17 +551,11 @@ namespace PUERTS_NAMESPACE
             CallbackData->Finalize(Isolate, CallbackData->Data);
 #endif
         }
-        for (auto it = CallbackData->JSE->CallbackWithFinalizeInfos.begin(); it != CallbackData->JSE->CallbackWithFinalizeInfos.end(); )
-        {
-            if (*it == CallbackData)
-            {
-                it = CallbackData->JSE->CallbackWithFinalizeInfos.erase(it);
-            }
-            else
-            {
-                ++it;
-            }
-        }
+        auto& Infos = CallbackData->JSE->CallbackWithFinalizeInfos;
+        FCallbackInfoWithFinalize* Last = Infos.back();
+        Infos[CallbackData->Index] = Last;
+        Last->Index = CallbackData->Index;
+        Infos.pop_back();
         delete CallbackData;
     }
     
@@ -488,6 +577,7 @@ namespace PUERTS_NAMESPACE
             CallbackData->JsFunction.Reset(Isolate, Ret.ToLocalChecked());
             CallbackData->JsFunction.SetWeak<FCallbackInfoWithFinalize>(
                 CallbackData, CallbackDataGarbageCollected, v8::WeakCallbackType::kInternalFields);
+            CallbackData->Index = CallbackWithFinalizeInfos.size();
             CallbackWithFinalizeInfos.push_back(CallbackData);
         }
         else
@@ -690,8 +780,8 @@ namespace PUERTS_NAMESPACE
             return v8::Undefined(Isolate);
         }
 
-        auto Iter = ObjectMap.find(Ptr);
-        if (Iter == ObjectMap.end())//create and link
+        auto Persistent = ObjectMap.Find(Ptr);
+        if (!Persistent)//create and link
         {
             auto BindTo = v8::External::New(Context->GetIsolate(), Ptr);
             v8::Local<v8::Value> Args[] = { BindTo };
@@ -699,7 +789,7 @@ namespace PUERTS_NAMESPACE
         }
         else
         {
-            return v8::Local<v8::Value>::New(Isolate, Iter->second);
+            return v8::Local<v8::Value>::New(Isolate, *Persistent);
         }
     }
 
@@ -707,7 +797,7 @@ namespace PUERTS_NAMESPACE
     {
         if (LifeCycleInfo->Size > 0)
         {
-            void *Val = malloc(LifeCycleInfo->Size);
+            void *Val = StructPool.Alloc(LifeCycleInfo->Size);
             if (Ptr != nullptr)
             {
                 memcpy(Val, Ptr, LifeCycleInfo->Size);
@@ -730,11 +820,11 @@ namespace PUERTS_NAMESPACE
 
     void JSEngine::UnBindObject(FLifeCycleInfo* LifeCycleInfo, void* Ptr)
     {
-        ObjectMap.erase(Ptr);
+        ObjectMap.Erase(Ptr);
 
         if (LifeCycleInfo->Size > 0)
         {
-            free(Ptr);
+            StructPool.Free(Ptr, LifeCycleInfo->Size);
         }
         else
         {
@@ -748,6 +838,7 @@ namespace PUERTS_NAMESPACE
     void JSEngine::LowMemoryNotification()
     {
         MainIsolate->LowMemoryNotification();
+        FlushArrayBufferReleases();
     }
 
     bool JSEngine::IdleNotificationDeadline(double DeadlineInSeconds)
@@ -786,6 +877,7 @@ namespace PUERTS_NAMESPACE
     void JSEngine::LogicTick()
     {
         BackendEnv.LogicTick();
+        FlushArrayBufferReleases();
     }
 
     bool JSEngine::InspectorTick()
@@ -41,19 +41,10 @@ namespace PUERTS_NAMESPACE
 
     JSFunction::~JSFunction()
     {
-        v8::Isolate* Isolate = ResultInfo.Isolate;
 #ifdef THREAD_SAFE
-        v8::Locker Locker(Isolate);
+        v8::Locker Locker(ResultInfo.Isolate);
 #endif
-        v8::Isolate::Scope IsolateScope(Isolate);
-        v8::HandleScope HandleScope(Isolate);
-        v8::Local<v8::Context> Context = ResultInfo.Context.Get(Isolate);
-        v8::Context::Scope ContextScope(Context);
-
-        auto Function = GFunction.Get(Isolate);
-
-        Function->Set(Context, FV8Utils::V8String(Isolate, FUNCTION_INDEX_KEY), v8::Undefined(Isolate));
-
+        // the id left on the js function is rejected by its slot generation, no need to clear it here
         GFunction.Reset();
         ResultInfo.Result.Reset();
         ResultInfo.Context.Reset();
@@ -111,8 +102,78 @@ namespace PUERTS_NAMESPACE
             Arguments[i].Persistent.Reset();
         }
         Arguments.clear();
+        return Call(Isolate, Context, static_cast<int>(V8Args.size()), V8Args.data(), HasResult);
+    }
+
+    static v8::Local<v8::Value> ToV8(v8::Isolate* Isolate, v8::Local<v8::Context> Context, const puerts::FArgumentValue &Value,
+        const char* Buffer)
+    {
+        switch (Value.Type)
+        {
+        case puerts::NullOrUndefined:
+            return v8::Null(Isolate);
+        case puerts::BigInt:
+            return v8::BigInt::New(Isolate, Value.BigInt);
+        case puerts::Number:
+            return v8::Number::New(Isolate, Value.Number);
+        case puerts::Date:
+            return v8::Date::New(Context, Value.Number).ToLocalChecked();
+        case puerts::String:
+            return v8::String::NewFromUtf8(Isolate, Buffer + reinterpret_cast<intptr_t>(Value.Ptr), v8::NewStringType::kNormal,
+                Value.Length).ToLocalChecked();
+        case puerts::NativeObject:
+            return FV8Utils::IsolateData<JSEngine>(Isolate)->FindOrAddObject(Isolate, Context, Value.Length, const_cast<void*>(Value.Ptr));
+        case puerts::Function:
+            return static_cast<const JSFunction*>(Value.Ptr)->GFunction.Get(Isolate);
+        case puerts::JsObject:
+            return static_cast<const JSObject*>(Value.Ptr)->GObject.Get(Isolate);
+        case puerts::Boolean:
+            return v8::Boolean::New(Isolate, Value.Boolean != 0);
+        case puerts::ArrayBuffer:
+            if (Value.Release)
+            {
+                return NewExternalArrayBuffer(Isolate, const_cast<void*>(Value.Ptr), Value.Length,
+                    reinterpret_cast<CSharpArrayBufferReleaseCallback>(static_cast<intptr_t>(Value.Release)),
+                    reinterpret_cast<void*>(static_cast<intptr_t>(Value.ReleaseUserData)));
+            }
+            return NewArrayBuffer(Isolate, const_cast<char*>(Buffer + reinterpret_cast<intptr_t>(Value.Ptr)), Value.Length);
+        default:
+            return v8::Undefined(Isolate);
+        }
+    }
+
+    bool JSFunction::Invoke(const puerts::FArgumentValue* Args, int ArgCount, const void* Buffer, bool HasResult)
+    {
+        v8::Isolate* Isolate = ResultInfo.Isolate;
+#ifdef THREAD_SAFE
+        v8::Locker Locker(Isolate);
+#endif
+        v8::Isolate::Scope IsolateScope(Isolate);
+        v8::HandleScope HandleScope(Isolate);
+        v8::Local<v8::Context> Context = ResultInfo.Context.Get(Isolate);
+        v8::Context::Scope ContextScope(Context);
+
+        // the common case converts straight into stack storage, no Persistent nor heap allocation
+        constexpr int kStackArgs = 16;
+        v8::Local<v8::Value> StackArgs[kStackArgs];
+        std::vector<v8::Local<v8::Value>> HeapArgs;
+        v8::Local<v8::Value>* V8Args = StackArgs;
+        if (ArgCount > kStackArgs)
+        {
+            HeapArgs.resize(ArgCount);
+            V8Args = HeapArgs.data();
+        }
+        for (int i = 0; i < ArgCount; ++i)
+        {
+            V8Args[i] = ToV8(Isolate, Context, Args[i], static_cast<const char*>(Buffer));
+        }
+        return Call(Isolate, Context, ArgCount, V8Args, HasResult);
+    }
+
+    bool JSFunction::Call(v8::Isolate* Isolate, v8::Local<v8::Context> Context, int Argc, v8::Local<v8::Value>* Argv, bool HasResult)
+    {
         v8::TryCatch TryCatch(Isolate);
-        auto maybeValue = GFunction.Get(Isolate)->Call(Context, Context->Global(), static_cast<int>(V8Args.size()), V8Args.data());
+        auto maybeValue = GFunction.Get(Isolate)->Call(Context, Context->Global(), Argc, Argv);
         
         if (TryCatch.HasCaught())
         {
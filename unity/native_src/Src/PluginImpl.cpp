@@ -32,6 +32,12 @@ public:
     virtual void* Eval(const char *Code, const char* Path) override;
 
     virtual bool ClearModuleCache(const char* Path) override;
+
+    virtual void SetModuleCodeCacheDir(const char* Dir) override;
+
+    virtual bool SetModuleCodeCacheBundle(const char* Path) override;
+
+    virtual void GetModuleCodeCacheStats(int32_t* Hits, int32_t* Misses, int32_t* Rejected) override;
     
     virtual int RegisterClass(int BaseTypeId, const char *FullName, puerts::FuncPtr Constructor, puerts::FuncPtr Destructor, int64_t Data, int Size) override;
     
@@ -93,6 +99,8 @@ public:
 
     virtual void SetArrayBufferToOutValue(void* Value, unsigned char *Bytes, int Length) override;
 
+    virtual void SetExternalArrayBufferToOutValue(void* Value, void* Data, int Length, puerts::FuncPtr Release, void* UserData) override;
+
     virtual void *GetObjectFromValue(void* Value, int IsOut) override;
 
     virtual int GetTypeIdFromValue(void* Value, int IsOut) override;
@@ -123,6 +131,8 @@ public:
 
     virtual void ReturnArrayBuffer(const void* Info, unsigned char *Bytes, int Length) override;
 
+    virtual void ReturnExternalArrayBuffer(const void* Info, void* Data, int Length, puerts::FuncPtr Release, void* UserData) override;
+
     virtual void ReturnBoolean(const void* Info, int Bool) override;
 
     virtual void ReturnDate(const void* Info, double Date) override;
@@ -150,6 +160,8 @@ public:
 
     virtual void PushArrayBufferForJSFunction(void* Function, unsigned char * Bytes, int Length) override;
 
+    virtual void PushExternalArrayBufferForJSFunction(void* Function, void* Data, int Length, puerts::FuncPtr Release, void* UserData) override;
+
     virtual void PushStringForJSFunction(void* Function, const char* S) override;
 
     virtual void PushNumberForJSFunction(void* Function, double D) override;
@@ -162,6 +174,8 @@ public:
 
     virtual void* InvokeJSFunction(void* Function, int HasResult) override;
 
+    virtual void* InvokeJSFunctionWithArguments(void* Function, const puerts::FArgumentValue* Arguments, int ArgumentCount, const void* Buffer, int HasResult) override;
+
     virtual puerts::JsValueType GetResultType(void* ResultInfo) override;
 
     virtual double GetNumberFromResult(void* ResultInfo) override;
@@ -245,6 +259,23 @@ bool V8Plugin::ClearModuleCache(const char* Path)
     return jsEngine.ClearModuleCache(Path);
 }
 
+void V8Plugin::SetModuleCodeCacheDir(const char* Dir)
+{
+    jsEngine.BackendEnv.SetCodeCacheDir(Dir);
+}
+
+bool V8Plugin::SetModuleCodeCacheBundle(const char* Path)
+{
+    return jsEngine.BackendEnv.SetCodeCacheBundle(Path);
+}
+
+void V8Plugin::GetModuleCodeCacheStats(int32_t* Hits, int32_t* Misses, int32_t* Rejected)
+{
+    *Hits = jsEngine.BackendEnv.CodeCacheHits;
+    *Misses = jsEngine.BackendEnv.CodeCacheMisses;
+    *Rejected = jsEngine.BackendEnv.CodeCacheRejected;
+}
+
 int V8Plugin::RegisterClass(int BaseTypeId, const char *FullName, puerts::FuncPtr Constructor, puerts::FuncPtr Destructor, int64_t Data, int Size)
 {
     return jsEngine.RegisterClass(FullName, BaseTypeId, (PUERTS_NAMESPACE::CSharpConstructorCallback)Constructor, (PUERTS_NAMESPACE::CSharpDestructorCallback)Destructor, Data, Size);
@@ -586,6 +617,24 @@ void V8Plugin::SetArrayBufferToOutValue(void* pValue, unsigned char *Bytes, int
     }
 }
 
+void V8Plugin::SetExternalArrayBufferToOutValue(void* pValue, void* Data, int Length, puerts::FuncPtr Release, void* UserData)
+{
+    v8::Isolate* Isolate = jsEngine.MainIsolate;
+    const v8::Value *Value = (const v8::Value *)pValue;
+    auto ReleaseCallback = (PUERTS_NAMESPACE::CSharpArrayBufferReleaseCallback)Release;
+    if (Value->IsObject())
+    {
+        auto Context = Isolate->GetCurrentContext();
+        auto Outer = Value->ToObject(Context).ToLocalChecked();
+        v8::Local<v8::ArrayBuffer> Ab = PUERTS_NAMESPACE::NewExternalArrayBuffer(Isolate, Data, Length, ReleaseCallback, UserData);
+        auto ReturnVal = Outer->Set(Context, 0, Ab);
+    }
+    else if (ReleaseCallback)
+    {
+        ReleaseCallback(Data, UserData);
+    }
+}
+
 void* V8Plugin::GetObjectFromValue(void* pValue, int IsOut)
 {
     v8::Isolate* Isolate = jsEngine.MainIsolate;
@@ -765,6 +814,13 @@ void V8Plugin::ReturnArrayBuffer(const void* pInfo, unsigned char *Bytes, int Le
     Info.GetReturnValue().Set(PUERTS_NAMESPACE::NewArrayBuffer(Isolate, Bytes, Length));
 }
 
+void V8Plugin::ReturnExternalArrayBuffer(const void* pInfo, void* Data, int Length, puerts::FuncPtr Release, void* UserData)
+{
+    v8::Isolate* Isolate = jsEngine.MainIsolate;
+    const v8::FunctionCallbackInfo<v8::Value>& Info =  *(const v8::FunctionCallbackInfo<v8::Value>*)pInfo;
+    Info.GetReturnValue().Set(PUERTS_NAMESPACE::NewExternalArrayBuffer(Isolate, Data, Length, (PUERTS_NAMESPACE::CSharpArrayBufferReleaseCallback)Release, UserData));
+}
+
 void V8Plugin::ReturnBoolean(const void* pInfo, int Bool)
 {
     const v8::FunctionCallbackInfo<v8::Value>& Info =  *(const v8::FunctionCallbackInfo<v8::Value>*)pInfo;
@@ -889,6 +945,23 @@ void V8Plugin::PushArrayBufferForJSFunction(void* pFunction, unsigned char * Byt
     Function->Arguments.push_back(std::move(Value));
 }
 
+void V8Plugin::PushExternalArrayBufferForJSFunction(void* pFunction, void* Data, int Length, puerts::FuncPtr Release, void* UserData)
+{
+    PUERTS_NAMESPACE::JSFunction *Function = (PUERTS_NAMESPACE::JSFunction *)pFunction;
+    auto Isolate = Function->ResultInfo.Isolate;
+#ifdef THREAD_SAFE
+    v8::Locker Locker(Isolate);
+#endif
+    v8::Isolate::Scope IsolateScope(Isolate);
+    v8::HandleScope HandleScope(Isolate);
+    v8::Local<v8::Context> Context = Function->ResultInfo.Context.Get(Isolate);
+    v8::Context::Scope ContextScope(Context);
+    FValue Value;
+    Value.Type = puerts::ArrayBuffer;
+    Value.Persistent.Reset(Isolate, PUERTS_NAMESPACE::NewExternalArrayBuffer(Isolate, Data, Length, (PUERTS_NAMESPACE::CSharpArrayBufferReleaseCallback)Release, UserData));
+    Function->Arguments.push_back(std::move(Value));
+}
+
 void V8Plugin::PushStringForJSFunction(void* pFunction, const char* S)
 {
     PUERTS_NAMESPACE::JSFunction *Function = (PUERTS_NAMESPACE::JSFunction *)pFunction;
@@ -956,6 +1029,19 @@ void* V8Plugin::InvokeJSFunction(void* pFunction, int HasResult)
     }
 }
 
+void* V8Plugin::InvokeJSFunctionWithArguments(void* pFunction, const puerts::FArgumentValue* Arguments, int ArgumentCount, const void* Buffer, int HasResult)
+{
+    PUERTS_NAMESPACE::JSFunction *Function = (PUERTS_NAMESPACE::JSFunction *)pFunction;
+    if (Function->Invoke(Arguments, ArgumentCount, Buffer, HasResult))
+    {
+        return &(Function->ResultInfo);
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
 puerts::JsValueType V8Plugin::GetResultType(void* pResultInfo)
 {
     PUERTS_NAMESPACE::FResultInfo *ResultInfo = (PUERTS_NAMESPACE::FResultInfo *)pResultInfo;
@@ -136,6 +136,28 @@ V8_EXPORT bool ClearModuleCache(v8::Isolate *Isolate, const char* Path)
     return JsEngine->ClearModuleCache(Path);
 }   
 
+// code cache for ES modules, an empty or null Dir disables it
+V8_EXPORT void SetModuleCodeCacheDir(v8::Isolate *Isolate, const char* Dir)
+{
+    auto JsEngine = FV8Utils::IsolateData<JSEngine>(Isolate);
+    JsEngine->BackendEnv.SetCodeCacheDir(Dir);
+}
+
+// precompiled ES modules from `v8cc --batch`, a null Path unloads the bundle
+V8_EXPORT bool SetModuleCodeCacheBundle(v8::Isolate *Isolate, const char* Path)
+{
+    auto JsEngine = FV8Utils::IsolateData<JSEngine>(Isolate);
+    return JsEngine->BackendEnv.SetCodeCacheBundle(Path);
+}
+
+V8_EXPORT void GetModuleCodeCacheStats(v8::Isolate *Isolate, int32_t* Hits, int32_t* Misses, int32_t* Rejected)
+{
+    auto JsEngine = FV8Utils::IsolateData<JSEngine>(Isolate);
+    *Hits = JsEngine->BackendEnv.CodeCacheHits;
+    *Misses = JsEngine->BackendEnv.CodeCacheMisses;
+    *Rejected = JsEngine->BackendEnv.CodeCacheRejected;
+}
+
 V8_EXPORT int _RegisterClass(v8::Isolate *Isolate, int BaseTypeId, const char *FullName, puerts::CSharpConstructorCallback Constructor, puerts::CSharpDestructorCallback Destructor, int64_t Data)
 {
     auto JsEngine = FV8Utils::IsolateData<JSEngine>(Isolate);
@@ -448,6 +470,21 @@ V8_EXPORT void SetArrayBufferToOutValue(v8::Isolate* Isolate, v8::Value *Value,
     }
 }
 
+V8_EXPORT void SetExternalArrayBufferToOutValue(v8::Isolate* Isolate, v8::Value *Value, void *Data, int Length, puerts::CSharpArrayBufferReleaseCallback Release, void* UserData)
+{
+    if (Value->IsObject())
+    {
+        auto Context = Isolate->GetCurrentContext();
+        auto Outer = Value->ToObject(Context).ToLocalChecked();
+        v8::Local<v8::ArrayBuffer> Ab = puerts::NewExternalArrayBuffer(Isolate, Data, Length, Release, UserData);
+        auto ReturnVal = Outer->Set(Context, 0, Ab);
+    }
+    else if (Release)
+    {
+        Release(Data, UserData);
+    }
+}
+
 V8_EXPORT void *GetObjectFromValue(v8::Isolate* Isolate, v8::Value *Value, int IsOut)
 {
     if (IsOut)
@@ -608,6 +645,11 @@ V8_EXPORT void ReturnArrayBuffer(v8::Isolate* Isolate, const v8::FunctionCallbac
     Info.GetReturnValue().Set(puerts::NewArrayBuffer(Isolate, Bytes, Length));
 }
 
+V8_EXPORT void ReturnExternalArrayBuffer(v8::Isolate* Isolate, const v8::FunctionCallbackInfo<v8::Value>& Info, void *Data, int Length, puerts::CSharpArrayBufferReleaseCallback Release, void* UserData)
+{
+    Info.GetReturnValue().Set(puerts::NewExternalArrayBuffer(Isolate, Data, Length, Release, UserData));
+}
+
 V8_EXPORT void ReturnBoolean(v8::Isolate* Isolate, const v8::FunctionCallbackInfo<v8::Value>& Info, int Bool)
 {
     Info.GetReturnValue().Set(Bool ? true : false);
@@ -716,6 +758,22 @@ V8_EXPORT void PushArrayBufferForJSFunction(JSFunction *Function, unsigned char
     Function->Arguments.push_back(std::move(Value));
 }
 
+V8_EXPORT void PushExternalArrayBufferForJSFunction(JSFunction *Function, void *Data, int Length, puerts::CSharpArrayBufferReleaseCallback Release, void* UserData)
+{
+    auto Isolate = Function->ResultInfo.Isolate;
+#ifdef THREAD_SAFE
+    v8::Locker Locker(Isolate);
+#endif
+    v8::Isolate::Scope IsolateScope(Isolate);
+    v8::HandleScope HandleScope(Isolate);
+    v8::Local<v8::Context> Context = Function->ResultInfo.Context.Get(Isolate);
+    v8::Context::Scope ContextScope(Context);
+    FValue Value;
+    Value.Type = puerts::ArrayBuffer;
+    Value.Persistent.Reset(Isolate, puerts::NewExternalArrayBuffer(Isolate, Data, Length, Release, UserData));
+    Function->Arguments.push_back(std::move(Value));
+}
+
 V8_EXPORT void PushStringForJSFunction(JSFunction *Function, const char* S)
 {
     FValue Value;
@@ -778,6 +836,19 @@ V8_EXPORT FResultInfo *InvokeJSFunction(JSFunction *Function, int HasResult)
     }
 }
 
+// invoke with a caller owned argument block in one call instead of Push*ForJSFunction per argument
+V8_EXPORT FResultInfo *InvokeJSFunctionWithArguments(JSFunction *Function, const puerts::FArgumentValue *Arguments, int ArgumentCount, const void *Buffer, int HasResult)
+{
+    if (Function->Invoke(Arguments, ArgumentCount, Buffer, HasResult))
+    {
+        return &(Function->ResultInfo);
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
 V8_EXPORT JsValueType GetResultType(FResultInfo *ResultInfo)
 {
     if (ResultInfo->Result.IsEmpty())
@@ -119,6 +119,21 @@ PUERTS_EXPORT bool ClearModuleCache(puerts::IPuertsPlugin* plugin, const char* P
     return plugin->ClearModuleCache(Path);
 }   
 
+PUERTS_EXPORT void SetModuleCodeCacheDir(puerts::IPuertsPlugin* plugin, const char* Dir)
+{
+    plugin->SetModuleCodeCacheDir(Dir);
+}
+
+PUERTS_EXPORT bool SetModuleCodeCacheBundle(puerts::IPuertsPlugin* plugin, const char* Path)
+{
+    return plugin->SetModuleCodeCacheBundle(Path);
+}
+
+PUERTS_EXPORT void GetModuleCodeCacheStats(puerts::IPuertsPlugin* plugin, int32_t* Hits, int32_t* Misses, int32_t* Rejected)
+{
+    plugin->GetModuleCodeCacheStats(Hits, Misses, Rejected);
+}
+
 PUERTS_EXPORT int _RegisterClass(puerts::IPuertsPlugin* plugin, int BaseTypeId, const char *FullName, puerts::FuncPtr Constructor, puerts::FuncPtr Destructor, int64_t Data)
 {
     return plugin->RegisterClass(BaseTypeId, FullName, Constructor, Destructor, Data, 0);
@@ -257,6 +272,11 @@ PUERTS_EXPORT void SetArrayBufferToOutValue(puerts::IPuertsPlugin* plugin, void*
     plugin->SetArrayBufferToOutValue(Value, Bytes, Length);
 }
 
+PUERTS_EXPORT void SetExternalArrayBufferToOutValue(puerts::IPuertsPlugin* plugin, void* Value, void* Data, int Length, puerts::FuncPtr Release, void* UserData)
+{
+    plugin->SetExternalArrayBufferToOutValue(Value, Data, Length, Release, UserData);
+}
+
 PUERTS_EXPORT void *GetObjectFromValue(puerts::IPuertsPlugin* plugin, void* Value, int IsOut)
 {
     return plugin->GetObjectFromValue(Value, IsOut);
@@ -331,6 +351,11 @@ PUERTS_EXPORT void ReturnArrayBuffer(puerts::IPuertsPlugin* plugin, const void*
     plugin->ReturnArrayBuffer(Info, Bytes, Length);
 }
 
+PUERTS_EXPORT void ReturnExternalArrayBuffer(puerts::IPuertsPlugin* plugin, const void* Info, void* Data, int Length, puerts::FuncPtr Release, void* UserData)
+{
+    plugin->ReturnExternalArrayBuffer(Info, Data, Length, Release, UserData);
+}
+
 PUERTS_EXPORT void ReturnBoolean(puerts::IPuertsPlugin* plugin, const void* Info, int Bool)
 {
     plugin->ReturnBoolean(Info, Bool);
@@ -395,6 +420,11 @@ PUERTS_EXPORT void PushArrayBufferForJSFunction(puerts::PuertsPluginStore* Funct
     Function->PuertsPlugin->PushArrayBufferForJSFunction(Function, Bytes, Length);
 }
 
+PUERTS_EXPORT void PushExternalArrayBufferForJSFunction(puerts::PuertsPluginStore* Function, void* Data, int Length, puerts::FuncPtr Release, void* UserData)
+{
+    Function->PuertsPlugin->PushExternalArrayBufferForJSFunction(Function, Data, Length, Release, UserData);
+}
+
 PUERTS_EXPORT void PushStringForJSFunction(puerts::PuertsPluginStore* Function, const char* S)
 {
     Function->PuertsPlugin->PushStringForJSFunction(Function, S);
@@ -425,6 +455,11 @@ PUERTS_EXPORT void* InvokeJSFunction(puerts::PuertsPluginStore* Function, int Ha
     return Function->PuertsPlugin->InvokeJSFunction(Function, HasResult);
 }
 
+PUERTS_EXPORT void* InvokeJSFunctionWithArguments(puerts::PuertsPluginStore* Function, const puerts::FArgumentValue* Arguments, int ArgumentCount, const void* Buffer, int HasResult)
+{
+    return Function->PuertsPlugin->InvokeJSFunctionWithArguments(Function, Arguments, ArgumentCount, Buffer, HasResult);
+}
+
 PUERTS_EXPORT puerts::JsValueType GetResultType(puerts::PuertsPluginStore* ResultInfo)
 {
     return ResultInfo->PuertsPlugin->GetResultType(ResultInfo);
@@ -0,0 +1,284 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+// Argument marshalling of the unreal FFunctionTranslator::CallJs (blueprint calling into js), modelled without the
+// engine: the property chain with a virtual InitializeValue and UEToJs per parameter and an out param record list,
+// against the flat CallJsPlan with inline conversions. A js function is called with the result so the share of the
+// marshalling in a whole call shows too. Loaded as a node addon to get a live isolate:
+//   node -e "process.exitCode = require('./CallJsParamBenchmark.node').run([calls])"
+
+#include <node.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+enum class EKind : uint8_t
+{
+    Generic,
+    Int32,
+    Float,
+    Double,
+    Bool
+};
+
+// stands in for FPropertyTranslator
+struct FTranslator
+{
+    virtual ~FTranslator() = default;
+    virtual v8::Local<v8::Value> UEToJs(v8::Isolate* Isolate, const void* ValuePtr) const = 0;
+};
+
+struct FInt32Translator : FTranslator
+{
+    v8::Local<v8::Value> UEToJs(v8::Isolate* Isolate, const void* ValuePtr) const override
+    {
+        return v8::Integer::New(Isolate, *static_cast<const int32_t*>(ValuePtr));
+    }
+};
+
+struct FFloatTranslator : FTranslator
+{
+    v8::Local<v8::Value> UEToJs(v8::Isolate* Isolate, const void* ValuePtr) const override
+    {
+        return v8::Number::New(Isolate, *static_cast<const float*>(ValuePtr));
+    }
+};
+
+struct FDoubleTranslator : FTranslator
+{
+    v8::Local<v8::Value> UEToJs(v8::Isolate* Isolate, const void* ValuePtr) const override
+    {
+        return v8::Number::New(Isolate, *static_cast<const double*>(ValuePtr));
+    }
+};
+
+struct FBoolTranslator : FTranslator
+{
+    v8::Local<v8::Value> UEToJs(v8::Isolate* Isolate, const void* ValuePtr) const override
+    {
+        return v8::Boolean::New(Isolate, *static_cast<const bool*>(ValuePtr));
+    }
+};
+
+// stands in for FProperty: a linked chain with a virtual InitializeValue
+struct FProperty
+{
+    FProperty* Next = nullptr;
+    int32_t Offset = 0;
+    int32_t Size = 0;
+    bool IsOutParm = false;
+
+    virtual ~FProperty() = default;
+    virtual void InitializeValue(void* Dest) const
+    {
+        std::memset(Dest, 0, Size);
+    }
+};
+
+struct FOutParmRec
+{
+    const FProperty* Property;
+    void* PropAddr;
+    FOutParmRec* NextOutParm;
+};
+
+struct FPlan
+{
+    const FProperty* Property;
+    int32_t Offset;
+    int32_t ArgumentIndex;
+    EKind Kind;
+    bool NeedInitialize;
+    bool IsOutParm;
+};
+
+// (int32 A, float B, bool C, double D, int32& Out)
+struct FSignature
+{
+    std::vector<std::unique_ptr<FProperty>> Properties;
+    std::vector<std::unique_ptr<FTranslator>> Translators;
+    std::vector<FPlan> Plan;
+    int32_t ParamsSize = 0;
+
+    void Add(int32_t Size, EKind Kind, FTranslator* Translator, bool IsOutParm = false)
+    {
+        auto Property = std::unique_ptr<FProperty>(new FProperty);
+        Property->Offset = (ParamsSize + Size - 1) / Size * Size;
+        Property->Size = Size;
+        Property->IsOutParm = IsOutParm;
+        ParamsSize = Property->Offset + Size;
+        if (!Properties.empty())
+        {
+            Properties.back()->Next = Property.get();
+        }
+        // out params are passed as a $ref, the plan leaves them to the translator
+        Plan.push_back({Property.get(), Property->Offset, static_cast<int32_t>(Plan.size()), IsOutParm ? EKind::Generic : Kind,
+            false, IsOutParm});
+        Properties.push_back(std::move(Property));
+        Translators.emplace_back(Translator);
+    }
+};
+
+// the property chain walk CallJs did before
+void MarshalByChain(v8::Isolate* Isolate, const FSignature& Signature, uint8_t* Params, uint8_t* CallerOut,
+    v8::Local<v8::Value>* Args)
+{
+    FOutParmRec* OutParms = nullptr;
+    FOutParmRec** LastOut = &OutParms;
+    FOutParmRec Records[8];
+    int RecordCount = 0;
+    for (const FProperty* Property = Signature.Properties[0].get(); Property; Property = Property->Next)
+    {
+        Property->InitializeValue(Params + Property->Offset);
+        if (Property->IsOutParm)
+        {
+            FOutParmRec* Out = &Records[RecordCount++];
+            Out->Property = Property;
+            Out->PropAddr = CallerOut;
+            Out->NextOutParm = nullptr;
+            *LastOut = Out;
+            LastOut = &Out->NextOutParm;
+        }
+    }
+    int ArgumentIndex = 0;
+    for (const FProperty* Property = Signature.Properties[0].get(); Property; Property = Property->Next, ++ArgumentIndex)
+    {
+        const void* ValuePtr = Params + Property->Offset;
+        if (Property->IsOutParm)
+        {
+            // GetMatchOutParmRec
+            for (FOutParmRec* Out = OutParms; Out; Out = Out->NextOutParm)
+            {
+                if (Out->Property == Property)
+                {
+                    ValuePtr = Out->PropAddr;
+                    break;
+                }
+            }
+        }
+        Args[ArgumentIndex] = Signature.Translators[ArgumentIndex]->UEToJs(Isolate, ValuePtr);
+    }
+}
+
+// the CallJsPlan walk
+void MarshalByPlan(v8::Isolate* Isolate, const FSignature& Signature, uint8_t* Params, uint8_t* CallerOut,
+    v8::Local<v8::Value>* Args)
+{
+    void* OutAddrs[8] = {};
+    for (const FPlan& Plan : Signature.Plan)
+    {
+        if (Plan.NeedInitialize)
+        {
+            Plan.Property->InitializeValue(Params + Plan.Offset);
+        }
+        if (Plan.IsOutParm)
+        {
+            OutAddrs[Plan.ArgumentIndex] = CallerOut;
+        }
+    }
+    for (const FPlan& Plan : Signature.Plan)
+    {
+        const void* ValuePtr = OutAddrs[Plan.ArgumentIndex] ? OutAddrs[Plan.ArgumentIndex] : Params + Plan.Offset;
+        switch (Plan.Kind)
+        {
+            case EKind::Int32:
+                Args[Plan.ArgumentIndex] = v8::Integer::New(Isolate, *static_cast<const int32_t*>(ValuePtr));
+                break;
+            case EKind::Float:
+                Args[Plan.ArgumentIndex] = v8::Number::New(Isolate, *static_cast<const float*>(ValuePtr));
+                break;
+            case EKind::Double:
+                Args[Plan.ArgumentIndex] = v8::Number::New(Isolate, *static_cast<const double*>(ValuePtr));
+                break;
+            case EKind::Bool:
+                Args[Plan.ArgumentIndex] = v8::Boolean::New(Isolate, *static_cast<const bool*>(ValuePtr));
+                break;
+            default:
+                Args[Plan.ArgumentIndex] = Signature.Translators[Plan.ArgumentIndex]->UEToJs(Isolate, ValuePtr);
+        }
+    }
+}
+
+template <typename Marshal>
+double NsPerCall(v8::Isolate* Isolate, v8::Local<v8::Context> Context, const FSignature& Signature,
+    v8::Local<v8::Function> Function, size_t Calls, Marshal&& MarshalFunc, double& Checksum)
+{
+    std::vector<uint8_t> Params(Signature.ParamsSize);
+    int32_t CallerOut = 7;
+    v8::Local<v8::Value> Args[8];
+    auto Start = Clock::now();
+    for (size_t i = 0; i < Calls; ++i)
+    {
+        v8::HandleScope HandleScope(Isolate);
+        MarshalFunc(Isolate, Signature, Params.data(), reinterpret_cast<uint8_t*>(&CallerOut), Args);
+        if (!Function.IsEmpty())
+        {
+            Checksum += Function->Call(Context, v8::Undefined(Isolate), static_cast<int>(Signature.Plan.size()), Args)
+                            .ToLocalChecked()
+                            ->NumberValue(Context)
+                            .FromJust();
+        }
+        else
+        {
+            Checksum += Args[4]->NumberValue(Context).FromJust();
+        }
+    }
+    return std::chrono::duration<double, std::nano>(Clock::now() - Start).count() / Calls;
+}
+
+void Run(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+    v8::Isolate* Isolate = Info.GetIsolate();
+    v8::Local<v8::Context> Context = Isolate->GetCurrentContext();
+    const size_t Calls = Info.Length() > 0 && Info[0]->IsNumber() ? Info[0]->Uint32Value(Context).FromJust() : 2000000;
+
+    FSignature Signature;
+    Signature.Add(4, EKind::Int32, new FInt32Translator);
+    Signature.Add(4, EKind::Float, new FFloatTranslator);
+    Signature.Add(1, EKind::Bool, new FBoolTranslator);
+    Signature.Add(8, EKind::Double, new FDoubleTranslator);
+    Signature.Add(4, EKind::Int32, new FInt32Translator, true);
+
+    auto Source = v8::String::NewFromUtf8(Isolate, "(function(a, b, c, d, e) { return a + b + d + e + (c ? 1 : 0); })")
+                      .ToLocalChecked();
+    auto Function =
+        v8::Script::Compile(Context, Source).ToLocalChecked()->Run(Context).ToLocalChecked().As<v8::Function>();
+
+    double ChainChecksum = 0, PlanChecksum = 0;
+    double ChainNs = NsPerCall(Isolate, Context, Signature, v8::Local<v8::Function>(), Calls, MarshalByChain, ChainChecksum);
+    double PlanNs = NsPerCall(Isolate, Context, Signature, v8::Local<v8::Function>(), Calls, MarshalByPlan, PlanChecksum);
+    double ChainCallNs = NsPerCall(Isolate, Context, Signature, Function, Calls, MarshalByChain, ChainChecksum);
+    double PlanCallNs = NsPerCall(Isolate, Context, Signature, Function, Calls, MarshalByPlan, PlanChecksum);
+
+    std::printf("%zu calls of (int32, float, bool, double, int32&)\n", Calls);
+    std::printf("%-24s %8.1f ns/call  plan %8.1f ns/call  (%.2fx)\n", "marshal only", ChainNs, PlanNs, ChainNs / PlanNs);
+    std::printf("%-24s %8.1f ns/call  plan %8.1f ns/call  (%.2fx)\n", "marshal + js call", ChainCallNs, PlanCallNs,
+        ChainCallNs / PlanCallNs);
+    const bool Ok = ChainChecksum == PlanChecksum;
+    if (!Ok)
+    {
+        std::fprintf(stderr, "chain and plan marshalled different arguments\n");
+    }
+    Info.GetReturnValue().Set(Ok ? 0 : 1);
+}
+
+void Init(v8::Local<v8::Object> Exports)
+{
+    NODE_SET_METHOD(Exports, "run", Run);
+}
+}    // namespace
+
+NODE_MODULE(NODE_GYP_MODULE_NAME, Init)
@@ -0,0 +1,156 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+// FString to js string in the unreal FV8Utils, with std::u16string standing in for FString (a 2 byte TCHAR):
+// ToV8String copies the characters onto the v8 heap with NewFromTwoByte, ToExternalV8String (PUERTS_EXTERNAL_STRING_THRESHOLD)
+// hands a moved or copied string to an external two byte string. The way back, ToFString, is timed through
+// v8::String::Value plus a copy against the direct String::Write into the FString storage.
+// Loaded as a node addon to get a live isolate:
+//   node -e "process.exitCode = require('./ExternalStringBenchmark.node').run([rounds])"
+
+#include <node.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+class FExternalStringResource : public v8::String::ExternalStringResource
+{
+public:
+    explicit FExternalStringResource(std::u16string&& InString) : String(std::move(InString))
+    {
+    }
+
+    const uint16_t* data() const override
+    {
+        return reinterpret_cast<const uint16_t*>(String.c_str());
+    }
+
+    size_t length() const override
+    {
+        return String.length();
+    }
+
+private:
+    std::u16string String;
+};
+
+v8::Local<v8::String> ToV8String(v8::Isolate* Isolate, const std::u16string& String)
+{
+    // TCHAR_TO_UTF16 is a cast with a 2 byte TCHAR, the length comes from the terminator
+    return v8::String::NewFromTwoByte(Isolate, reinterpret_cast<const uint16_t*>(String.c_str()), v8::NewStringType::kNormal)
+        .ToLocalChecked();
+}
+
+v8::Local<v8::String> ToExternalV8String(v8::Isolate* Isolate, std::u16string&& String)
+{
+    return v8::String::NewExternalTwoByte(Isolate, new FExternalStringResource(std::move(String))).ToLocalChecked();
+}
+
+std::u16string ToFStringByValue(v8::Isolate* Isolate, v8::Local<v8::String> String)
+{
+    v8::String::Value Value(Isolate, String);
+    return std::u16string(reinterpret_cast<const char16_t*>(*Value), Value.length());
+}
+
+std::u16string ToFStringByWrite(v8::Isolate* Isolate, v8::Local<v8::String> String)
+{
+    std::u16string Result;
+    Result.resize(String->Length());
+    String->Write(Isolate, reinterpret_cast<uint16_t*>(&Result[0]), 0, String->Length(), v8::String::NO_NULL_TERMINATION);
+    return Result;
+}
+
+template <typename Func>
+double UsPerRound(int Rounds, Func&& Body)
+{
+    auto Start = Clock::now();
+    for (int i = 0; i < Rounds; ++i)
+    {
+        Body(i);
+    }
+    return std::chrono::duration<double, std::micro>(Clock::now() - Start).count() / Rounds;
+}
+
+void Run(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+    v8::Isolate* Isolate = Info.GetIsolate();
+    v8::Local<v8::Context> Context = Isolate->GetCurrentContext();
+    const int Rounds = Info.Length() > 0 && Info[0]->IsNumber() ? Info[0]->Int32Value(Context).FromJust() : 200;
+    bool Ok = true;
+
+    std::printf("%-8s %14s %14s %14s %14s %14s\n", "chars", "copy us", "external us", "moved us", "Value+copy us",
+        "Write us");
+    for (size_t Length : {1024u / 2, 64u * 1024 / 2, 1024u * 1024 / 2})
+    {
+        std::u16string Source(Length, u'a');
+        for (size_t i = 0; i < Length; ++i)
+        {
+            Source[i] = static_cast<char16_t>(u'a' + i % 26 + (i % 7 == 0 ? 0x4e00 : 0));
+        }
+
+        double CopyUs = UsPerRound(Rounds,
+            [&](int)
+            {
+                v8::HandleScope HandleScope(Isolate);
+                Ok = Ok && ToV8String(Isolate, Source)->Length() == static_cast<int>(Length);
+            });
+        // const FString&: copied once into the resource
+        double ExternalUs = UsPerRound(Rounds,
+            [&](int)
+            {
+                v8::HandleScope HandleScope(Isolate);
+                Ok = Ok && ToExternalV8String(Isolate, std::u16string(Source))->Length() == static_cast<int>(Length);
+            });
+        // FString&&: a temporary the caller built anyway, timed without building it
+        std::u16string Temporaries[8];
+        double MovedUs = 0;
+        for (int Round = 0; Round < Rounds; Round += 8)
+        {
+            for (auto& Temporary : Temporaries)
+            {
+                Temporary = Source;
+            }
+            MovedUs += UsPerRound(8,
+                           [&](int i)
+                           {
+                               v8::HandleScope HandleScope(Isolate);
+                               Ok = Ok && ToExternalV8String(Isolate, std::move(Temporaries[i]))->Length() ==
+                                              static_cast<int>(Length);
+                           }) *
+                       8;
+        }
+        MovedUs /= (Rounds + 7) / 8 * 8;
+
+        v8::HandleScope HandleScope(Isolate);
+        auto JsString = ToV8String(Isolate, Source);
+        double ValueUs = UsPerRound(Rounds, [&](int) { Ok = Ok && ToFStringByValue(Isolate, JsString) == Source; });
+        double WriteUs = UsPerRound(Rounds, [&](int) { Ok = Ok && ToFStringByWrite(Isolate, JsString) == Source; });
+
+        std::printf("%-8zu %14.2f %14.2f %14.2f %14.2f %14.2f\n", Length, CopyUs, ExternalUs, MovedUs, ValueUs, WriteUs);
+        Isolate->LowMemoryNotification();
+    }
+    if (!Ok)
+    {
+        std::fprintf(stderr, "a converted string differs from its source\n");
+    }
+    Info.GetReturnValue().Set(Ok ? 0 : 1);
+}
+
+void Init(v8::Local<v8::Object> Exports)
+{
+    NODE_SET_METHOD(Exports, "run", Run);
+}
+}    // namespace
+
+NODE_MODULE(NODE_GYP_MODULE_NAME, Init)
@@ -0,0 +1,195 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+// FindClassByID is lock free while RegisterJSClass takes a mutex. Readers on several threads look classes up while a
+// writer registers new ones (growing the table) and re-registers old ones; every class a reader knows to be published
+// must be found with its own TypeId. Build with -DPUERTS_TEST_TSAN=ON to run it under ThreadSanitizer.
+// Then lookups per thread count are timed against the std::map behind a mutex that the register used before.
+// Usage: JSClassRegisterTest [classes] [reader threads]
+
+#include "JSClassRegister.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+// TypeIds are addresses, one byte each is enough
+std::vector<char> TypeIds;
+std::vector<std::string> ScriptNames;
+
+void Register(size_t Index)
+{
+    PUERTS_NAMESPACE::JSClassDefinition ClassDef = JSClassEmptyDefinition;
+    ClassDef.TypeId = &TypeIds[Index];
+    ClassDef.ScriptName = ScriptNames[Index].c_str();
+    PUERTS_NAMESPACE::RegisterJSClass(ClassDef);
+}
+
+bool ConcurrentRegisterAndFind(size_t Classes, int Readers)
+{
+    std::atomic<size_t> Published(0);
+    std::atomic<bool> Done(false);
+    std::atomic<size_t> Misses(0);
+    std::atomic<size_t> Lookups(0);
+
+    std::vector<std::thread> Threads;
+    for (int r = 0; r < Readers; ++r)
+    {
+        Threads.emplace_back(
+            [&, r]
+            {
+                size_t Seed = r + 1, Local = 0;
+                while (!Done.load(std::memory_order_acquire))
+                {
+                    size_t Count = Published.load(std::memory_order_acquire);
+                    if (Count == 0)
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    Seed = Seed * 6364136223846793005ull + 1442695040888963407ull;
+                    size_t Index = (Seed >> 33) % Count;
+                    auto ClassDef = PUERTS_NAMESPACE::FindClassByID(&TypeIds[Index]);
+                    if (!ClassDef || ClassDef->TypeId != &TypeIds[Index] || ScriptNames[Index] != ClassDef->ScriptName)
+                    {
+                        Misses.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    // keeps the writer interleaved with the readers on few cores
+                    if ((++Local & 63) == 0)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+                Lookups.fetch_add(Local, std::memory_order_relaxed);
+            });
+    }
+
+    for (size_t i = 0; i < Classes; ++i)
+    {
+        Register(i);
+        Published.store(i + 1, std::memory_order_release);
+        if (i % 7 == 0)
+        {
+            // replaces a definition some reader may be holding
+            Register(i / 2);
+        }
+        std::this_thread::yield();
+    }
+    Done.store(true, std::memory_order_release);
+    for (auto& Thread : Threads)
+    {
+        Thread.join();
+    }
+
+    for (size_t i = 0; i < Classes; ++i)
+    {
+        if (PUERTS_NAMESPACE::FindClassByID(&TypeIds[i]) == nullptr)
+        {
+            Misses.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    std::printf("%zu classes registered under %d readers, %zu lookups, %zu misses\n", Classes, Readers, Lookups.load(),
+        Misses.load());
+    return Misses.load() == 0;
+}
+
+// the register before it went lock free
+struct FLockedMap
+{
+    std::mutex Mutex;
+    std::map<const void*, const void*> Map;
+
+    const void* Find(const void* TypeId)
+    {
+        std::lock_guard<std::mutex> Guard(Mutex);
+        auto Iter = Map.find(TypeId);
+        return Iter == Map.end() ? nullptr : Iter->second;
+    }
+};
+
+template <typename Find>
+double LookupsPerMs(int ThreadCount, size_t Classes, Find&& FindFunc)
+{
+    const size_t PerThread = 2000000;
+    std::atomic<size_t> Found(0);
+    std::vector<std::thread> Threads;
+    auto Start = Clock::now();
+    for (int t = 0; t < ThreadCount; ++t)
+    {
+        Threads.emplace_back(
+            [&, t]
+            {
+                size_t Seed = t + 1, Local = 0;
+                for (size_t i = 0; i < PerThread; ++i)
+                {
+                    Seed = Seed * 6364136223846793005ull + 1442695040888963407ull;
+                    Local += FindFunc(&TypeIds[(Seed >> 33) % Classes]) != nullptr;
+                }
+                Found.fetch_add(Local);
+            });
+    }
+    for (auto& Thread : Threads)
+    {
+        Thread.join();
+    }
+    double Ms = std::chrono::duration<double, std::milli>(Clock::now() - Start).count();
+    return Found.load() == PerThread * ThreadCount ? PerThread * ThreadCount / Ms : 0;
+}
+}    // namespace
+
+int main(int argc, char** argv)
+{
+    size_t Classes = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 5000;
+    int Readers = argc > 2 ? std::atoi(argv[2]) : 4;
+    if (Classes == 0 || Readers <= 0)
+    {
+        std::fprintf(stderr, "usage: %s [classes] [reader threads]\n", argv[0]);
+        return 1;
+    }
+    TypeIds.resize(Classes);
+    for (size_t i = 0; i < Classes; ++i)
+    {
+        ScriptNames.push_back("Class" + std::to_string(i));
+    }
+
+    if (!ConcurrentRegisterAndFind(Classes, Readers))
+    {
+        std::fprintf(stderr, "a published class was not found\n");
+        return 1;
+    }
+
+    FLockedMap Locked;
+    for (size_t i = 0; i < Classes; ++i)
+    {
+        Locked.Map[&TypeIds[i]] = &TypeIds[i];
+    }
+    std::printf("%-8s %16s %16s\n", "threads", "lock free /ms", "mutex+map /ms");
+    for (int ThreadCount = 1; ThreadCount <= Readers; ThreadCount *= 2)
+    {
+        double LockFree = LookupsPerMs(
+            ThreadCount, Classes, [](const void* TypeId) { return PUERTS_NAMESPACE::FindClassByID(TypeId); });
+        double Mutex = LookupsPerMs(ThreadCount, Classes, [&Locked](const void* TypeId) { return Locked.Find(TypeId); });
+        std::printf("%-8d %16.0f %16.0f\n", ThreadCount, LockFree, Mutex);
+        if (LockFree == 0 || Mutex == 0)
+        {
+            std::fprintf(stderr, "lookups missed\n");
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,128 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+// Bulk numeric array transfer of the unreal pesapi (PesapiV8ArrayElements.h) against one property access per element,
+// which is what pesapi_get/set_property_uint32 cost an addon before. Loaded as a node addon to get a live isolate:
+//   node -e "process.exitCode = require('./PesapiArrayBenchmark.node').run([elements], [rounds])"
+
+#include <node.h>
+
+#include "PesapiV8ArrayElements.h"
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+double Ms(Clock::time_point Start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - Start).count();
+}
+
+double Sum(const std::vector<double>& Values)
+{
+    double Result = 0;
+    for (auto Value : Values)
+    {
+        Result += Value;
+    }
+    return Result;
+}
+
+void Run(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+    v8::Isolate* Isolate = Info.GetIsolate();
+    v8::Local<v8::Context> Context = Isolate->GetCurrentContext();
+    const size_t Count = Info.Length() > 0 && Info[0]->IsNumber() ? Info[0]->Uint32Value(Context).FromJust() : 100000;
+    const int Rounds = Info.Length() > 1 && Info[1]->IsNumber() ? Info[1]->Int32Value(Context).FromJust() : 20;
+
+    std::vector<double> Source(Count);
+    for (size_t i = 0; i < Count; ++i)
+    {
+        Source[i] = i * 0.5;
+    }
+    const double Expected = Sum(Source);
+    std::vector<double> Out(Count);
+    bool Ok = true;
+
+    // native -> js
+    double PerElementCreateMs = 0, BulkCreateMs = 0;
+    v8::Local<v8::Array> Array;
+    for (int Round = 0; Round < Rounds; ++Round)
+    {
+        v8::HandleScope HandleScope(Isolate);
+        auto Start = Clock::now();
+        auto PerElement = v8::Array::New(Isolate);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            PerElement->Set(Context, static_cast<uint32_t>(i), v8::Number::New(Isolate, Source[i])).Check();
+        }
+        PerElementCreateMs += Ms(Start);
+
+        Start = Clock::now();
+        auto Bulk = v8impl::CreateArrayFromBuffer(Context, Source.data(), Count);
+        BulkCreateMs += Ms(Start);
+
+        v8impl::GetArrayElements(Context, PerElement, 0, Out.data(), Count);
+        Ok = Ok && Sum(Out) == Expected;
+        v8impl::GetArrayElements(Context, Bulk, 0, Out.data(), Count);
+        Ok = Ok && Sum(Out) == Expected;
+    }
+
+    // js -> native, from an Array and from a Float64Array
+    v8::HandleScope HandleScope(Isolate);
+    auto JsArray = v8impl::CreateArrayFromBuffer(Context, Source.data(), Count);
+    auto Typed = v8::Float64Array::New(v8::ArrayBuffer::New(Isolate, Count * sizeof(double)), 0, Count);
+    v8impl::SetArrayElements(Context, Typed, 0, Source.data(), Count);
+
+    double PerElementGetMs = 0, BulkGetMs = 0, PerElementTypedGetMs = 0, BulkTypedGetMs = 0;
+    for (int Round = 0; Round < Rounds; ++Round)
+    {
+        for (int Kind = 0; Kind < 2; ++Kind)
+        {
+            v8::Local<v8::Object> Object = Kind == 0 ? v8::Local<v8::Object>(JsArray) : v8::Local<v8::Object>(Typed);
+            auto Start = Clock::now();
+            for (size_t i = 0; i < Count; ++i)
+            {
+                v8::HandleScope ElementScope(Isolate);
+                Out[i] = Object->Get(Context, static_cast<uint32_t>(i)).ToLocalChecked()->NumberValue(Context).FromJust();
+            }
+            (Kind == 0 ? PerElementGetMs : PerElementTypedGetMs) += Ms(Start);
+            Ok = Ok && Sum(Out) == Expected;
+
+            Start = Clock::now();
+            Ok = Ok && v8impl::GetArrayElements(Context, Object, 0, Out.data(), Count) == Count;
+            (Kind == 0 ? BulkGetMs : BulkTypedGetMs) += Ms(Start);
+            Ok = Ok && Sum(Out) == Expected;
+        }
+    }
+
+    std::printf("%zu doubles x %d rounds\n", Count, Rounds);
+    std::printf("%-28s %10.2f ms  bulk %10.2f ms  (%.2fx)\n", "create Array", PerElementCreateMs, BulkCreateMs,
+        PerElementCreateMs / BulkCreateMs);
+    std::printf("%-28s %10.2f ms  bulk %10.2f ms  (%.2fx)\n", "read Array", PerElementGetMs, BulkGetMs,
+        PerElementGetMs / BulkGetMs);
+    std::printf("%-28s %10.2f ms  bulk %10.2f ms  (%.2fx)\n", "read Float64Array", PerElementTypedGetMs, BulkTypedGetMs,
+        PerElementTypedGetMs / BulkTypedGetMs);
+    if (!Ok)
+    {
+        std::fprintf(stderr, "bulk and per element transfers disagree\n");
+    }
+    Info.GetReturnValue().Set(Ok ? 0 : 1);
+}
+
+void Init(v8::Local<v8::Object> Exports)
+{
+    NODE_SET_METHOD(Exports, "run", Run);
+}
+}    // namespace
+
+NODE_MODULE(NODE_GYP_MODULE_NAME, Init)
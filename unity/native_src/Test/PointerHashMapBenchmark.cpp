@@ -0,0 +1,180 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+// Bind/unbind churn on the bound object caches: a working set of live native objects, every cycle binds a new object,
+// looks a live one up and unbinds a random one. TPointerHashMap is compared with the std::map and std::unordered_map
+// that JSEngine::ObjectMap and FCppObjectMapper::CDataCache used before.
+// Usage: PointerHashMapBenchmark [cycles] [live objects]
+
+#include "PointerHashMap.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+struct FValue
+{
+    void* Object = nullptr;
+    int Generation = 0;
+};
+
+// cheap deterministic generator, so every map sees the same sequence of keys
+struct FRandom
+{
+    uint64_t State = 0x9E3779B97F4A7C15ull;
+
+    size_t Next(size_t Bound)
+    {
+        State ^= State << 13;
+        State ^= State >> 7;
+        State ^= State << 17;
+        return static_cast<size_t>(State % Bound);
+    }
+};
+
+struct FPointerHashMapAdapter
+{
+    static const char* Name()
+    {
+        return "TPointerHashMap";
+    }
+    PUERTS_NAMESPACE::TPointerHashMap<FValue> Map;
+    void Insert(void* Key, int Generation)
+    {
+        Map[Key] = FValue{Key, Generation};
+    }
+    const FValue* Find(void* Key)
+    {
+        return Map.Find(Key);
+    }
+    void Erase(void* Key)
+    {
+        Map.Erase(Key);
+    }
+};
+
+template <typename M>
+struct FStdMapAdapter
+{
+    M Map;
+    void Insert(void* Key, int Generation)
+    {
+        Map[Key] = FValue{Key, Generation};
+    }
+    const FValue* Find(void* Key)
+    {
+        auto Iter = Map.find(Key);
+        return Iter == Map.end() ? nullptr : &Iter->second;
+    }
+    void Erase(void* Key)
+    {
+        Map.erase(Key);
+    }
+};
+
+struct FMapAdapter : FStdMapAdapter<std::map<void*, FValue>>
+{
+    static const char* Name()
+    {
+        return "std::map";
+    }
+};
+
+struct FUnorderedMapAdapter : FStdMapAdapter<std::unordered_map<void*, FValue>>
+{
+    static const char* Name()
+    {
+        return "std::unordered_map";
+    }
+};
+
+// returns the elapsed milliseconds, Checksum lets the caller compare the maps and keeps the lookups alive
+template <typename Adapter>
+double Run(std::vector<char>& Arena, size_t Stride, size_t Cycles, size_t LiveCount, uint64_t& Checksum)
+{
+    Adapter Cache;
+    FRandom Random;
+    std::vector<void*> Live;
+    Live.reserve(LiveCount);
+    std::vector<void*> Freed;
+    size_t NextObject = 0;
+    auto NewObject = [&]() -> void*
+    {
+        // hand out the most recently freed address first, like a heap allocator
+        if (!Freed.empty())
+        {
+            void* Object = Freed.back();
+            Freed.pop_back();
+            return Object;
+        }
+        return &Arena[(NextObject++) * Stride];
+    };
+
+    for (size_t i = 0; i < LiveCount; ++i)
+    {
+        void* Object = NewObject();
+        Cache.Insert(Object, static_cast<int>(i));
+        Live.push_back(Object);
+    }
+
+    Checksum = 0;
+    auto Start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < Cycles; ++i)
+    {
+        void* Object = NewObject();
+        Cache.Insert(Object, static_cast<int>(i));
+
+        const FValue* Found = Cache.Find(Live[Random.Next(Live.size())]);
+        Checksum += Found ? static_cast<uint64_t>(Found->Generation) + 1 : 0;
+
+        size_t Victim = Random.Next(Live.size());
+        Cache.Erase(Live[Victim]);
+        Freed.push_back(Live[Victim]);
+        Live[Victim] = Object;
+    }
+    auto End = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(End - Start).count();
+}
+}    // namespace
+
+int main(int argc, char** argv)
+{
+    size_t Cycles = argc > 1 ? static_cast<size_t>(std::strtoull(argv[1], nullptr, 10)) : 500000;
+    size_t LiveCount = argc > 2 ? static_cast<size_t>(std::strtoull(argv[2], nullptr, 10)) : 10000;
+    if (Cycles == 0 || LiveCount == 0)
+    {
+        std::fprintf(stderr, "usage: %s [cycles] [live objects]\n", argv[0]);
+        return 1;
+    }
+
+    // 48 bytes apart, roughly the spacing of small heap objects, at most one object more than the live set is alive
+    const size_t Stride = 48;
+    std::vector<char> Arena((LiveCount + 1) * Stride);
+
+    uint64_t PointerHashMapChecksum, MapChecksum, UnorderedMapChecksum;
+    double PointerHashMapMs = Run<FPointerHashMapAdapter>(Arena, Stride, Cycles, LiveCount, PointerHashMapChecksum);
+    double MapMs = Run<FMapAdapter>(Arena, Stride, Cycles, LiveCount, MapChecksum);
+    double UnorderedMapMs = Run<FUnorderedMapAdapter>(Arena, Stride, Cycles, LiveCount, UnorderedMapChecksum);
+
+    std::printf("%zu cycles, %zu live objects\n", Cycles, LiveCount);
+    std::printf("%-20s %10.2f ms\n", FPointerHashMapAdapter::Name(), PointerHashMapMs);
+    std::printf("%-20s %10.2f ms  (%.2fx)\n", FMapAdapter::Name(), MapMs, MapMs / PointerHashMapMs);
+    std::printf("%-20s %10.2f ms  (%.2fx)\n", FUnorderedMapAdapter::Name(), UnorderedMapMs, UnorderedMapMs / PointerHashMapMs);
+
+    if (PointerHashMapChecksum != MapChecksum || PointerHashMapChecksum != UnorderedMapChecksum)
+    {
+        std::fprintf(stderr, "lookup results differ between the maps\n");
+        return 1;
+    }
+    return 0;
+}
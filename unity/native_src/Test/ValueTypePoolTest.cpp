@@ -0,0 +1,151 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+// The unreal ValueTypePool: struct values returned by static bindings are allocated as ValueTypePool<T> and released by
+// the reflected struct finalizer, which only knows the UScriptStruct size. Checks that both sides share blocks, then
+// times a box/unbox churn against new/delete.
+// Usage: ValueTypePoolTest [cycles]
+
+#include "ValueTypePool.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace
+{
+struct FVectorLike
+{
+    double X, Y, Z;
+};
+
+struct FTransformLike
+{
+    double Rotation[4], Translation[4], Scale[4];
+};
+
+int Failures = 0;
+
+void Check(bool Condition, const char* What)
+{
+    if (!Condition)
+    {
+        std::fprintf(stderr, "FAILED: %s\n", What);
+        ++Failures;
+    }
+}
+
+void TestSharedWithSizedFree()
+{
+    using namespace puerts;
+    // static binding side allocates typed, the struct finalizer frees by size
+    void* Typed = ValueTypePool<FVectorLike>::Alloc();
+    ValueBlockPool::Free(Typed, sizeof(FVectorLike));
+    Check(ValueBlockPool::Alloc(sizeof(FVectorLike)) == Typed, "a typed block is reused by a sized alloc");
+
+    // and the other way round, FScriptStructWrapper::Alloc then the ClassDefineBuilder finalizer
+    ValueBlockPool::Free(Typed, sizeof(FVectorLike));
+    Check(ValueTypePool<FVectorLike>::Alloc() == Typed, "a sized block is reused by a typed alloc");
+    ValueTypePool<FVectorLike>::Free(Typed);
+}
+
+void TestSizesNotMixed()
+{
+    using namespace puerts;
+    void* Small = ValueTypePool<FVectorLike>::Alloc();
+    ValueTypePool<FVectorLike>::Free(Small);
+    void* Large = ValueTypePool<FTransformLike>::Alloc();
+    Check(Large != Small, "a block is not handed out for another size");
+    ValueTypePool<FTransformLike>::Free(Large);
+    Check(ValueTypePool<FVectorLike>::Alloc() == Small, "the small block is still cached");
+    ValueTypePool<FVectorLike>::Free(Small);
+}
+
+void TestUnknownAndLargeSizes()
+{
+    using namespace puerts;
+    // an unloaded struct frees with size 0, a big one is never cached
+    void* Block = ValueBlockPool::Alloc(24);
+    ValueBlockPool::Free(Block, 0);
+    void* Big = ValueBlockPool::Alloc(ValueBlockPool::MaxPooledSize + 1);
+    ValueBlockPool::Free(Big, ValueBlockPool::MaxPooledSize + 1);
+}
+
+void TestOtherThreadFree()
+{
+    using namespace puerts;
+    void* Block = ValueTypePool<FVectorLike>::Alloc();
+    void* Cached = ValueTypePool<FVectorLike>::Alloc();
+    ValueTypePool<FVectorLike>::Free(Cached);
+    // a block released by a v8 worker joins that thread's list, deleted when the thread exits
+    bool ReusedOnWorker = false;
+    std::thread Worker(
+        [Block, &ReusedOnWorker]
+        {
+            ValueTypePool<FVectorLike>::Free(Block);
+            void* Again = ValueTypePool<FVectorLike>::Alloc();
+            ReusedOnWorker = Again == Block;
+            ValueTypePool<FVectorLike>::Free(Again);
+        });
+    Worker.join();
+    Check(ReusedOnWorker, "a block freed on another thread is cached there");
+    Check(ValueTypePool<FVectorLike>::Alloc() == Cached, "this thread's list is untouched by the other thread");
+    ValueTypePool<FVectorLike>::Free(Cached);
+}
+
+template <typename Alloc, typename Free>
+double Churn(size_t Cycles, Alloc&& AllocFunc, Free&& FreeFunc)
+{
+    // a few values alive at once, like the temporaries of a script loop
+    std::vector<FVectorLike*> Live(16, nullptr);
+    auto Start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < Cycles; ++i)
+    {
+        FVectorLike*& Slot = Live[i & 15];
+        if (Slot)
+        {
+            FreeFunc(Slot);
+        }
+        Slot = AllocFunc(FVectorLike{double(i), 1, 2});
+    }
+    for (auto Ptr : Live)
+    {
+        FreeFunc(Ptr);
+    }
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count();
+}
+}    // namespace
+
+int main(int argc, char** argv)
+{
+    size_t Cycles = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    if (Cycles == 0)
+    {
+        std::fprintf(stderr, "usage: %s [cycles]\n", argv[0]);
+        return 1;
+    }
+
+    TestSharedWithSizedFree();
+    TestSizesNotMixed();
+    TestUnknownAndLargeSizes();
+    TestOtherThreadFree();
+
+    double PoolMs = Churn(
+        Cycles, [](const FVectorLike& V) { return new (puerts::ValueTypePool<FVectorLike>::Alloc()) FVectorLike(V); },
+        [](FVectorLike* Ptr) { puerts::ValueBlockPool::Free(Ptr, sizeof(FVectorLike)); });
+    double NewMs = Churn(
+        Cycles, [](const FVectorLike& V) { return new FVectorLike(V); }, [](FVectorLike* Ptr) { delete Ptr; });
+
+    std::printf("%zu cycles\n", Cycles);
+    std::printf("%-20s %10.2f ms\n", "ValueTypePool", PoolMs);
+    std::printf("%-20s %10.2f ms  (%.2fx)\n", "new/delete", NewMs, NewMs / PoolMs);
+
+    return Failures == 0 ? 0 : 1;
+}
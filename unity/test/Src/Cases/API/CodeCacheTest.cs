@@ -0,0 +1,143 @@
+/*
+* Tencent is pleased to support the open source community by making Puerts available.
+* Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+* Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may be subject to their corresponding license terms.
+* This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this source code package.
+*/
+#if !UNITY_WEBGL
+using NUnit.Framework;
+using System.IO;
+using System.Text;
+
+namespace Puerts.UnitTest
+{
+    [TestFixture]
+    public class CodeCacheTest
+    {
+        [Test]
+        public void ModuleCodeCacheHit()
+        {
+            var cacheDir = Path.Combine(Path.GetTempPath(), "puerts_code_cache_test");
+            if (Directory.Exists(cacheDir)) Directory.Delete(cacheDir, true);
+            Directory.CreateDirectory(cacheDir);
+
+            var loader = new UnitTestLoader2();
+            loader.AddMockFileContent("code-cache/entry.mjs", @"
+                import { add } from './lib.mjs';
+                export const result = add(1, 2);
+            ");
+            loader.AddMockFileContent("code-cache/lib.mjs", @"
+                export function add(a, b) { return a + b; }
+            ");
+
+            int hits, misses, rejected;
+            var jsEnv = new JsEnv(loader);
+            if (jsEnv.Backend is BackendQuickJS)
+            {
+                jsEnv.Dispose();
+                return;
+            }
+            jsEnv.SetModuleCodeCacheDir(cacheDir);
+            jsEnv.ExecuteModule("code-cache/entry.mjs");
+            jsEnv.GetModuleCodeCacheStats(out hits, out misses, out rejected);
+            jsEnv.Dispose();
+            Assert.AreEqual(0, hits);
+            Assert.AreEqual(2, misses);
+            Assert.AreEqual(2, Directory.GetFiles(cacheDir).Length);
+
+            jsEnv = new JsEnv(loader);
+            jsEnv.SetModuleCodeCacheDir(cacheDir);
+            var ret = jsEnv.ExecuteModule<int>("code-cache/entry.mjs", "result");
+            jsEnv.GetModuleCodeCacheStats(out hits, out misses, out rejected);
+            jsEnv.Dispose();
+            Assert.AreEqual(3, ret);
+            Assert.AreEqual(2, hits);
+            Assert.AreEqual(0, misses);
+
+            // a changed source must not reuse the stale entry
+            loader.AddMockFileContent("code-cache/lib.mjs", @"
+                export function add(a, b) { return a + b + 1; }
+            ");
+            jsEnv = new JsEnv(loader);
+            jsEnv.SetModuleCodeCacheDir(cacheDir);
+            ret = jsEnv.ExecuteModule<int>("code-cache/entry.mjs", "result");
+            jsEnv.GetModuleCodeCacheStats(out hits, out misses, out rejected);
+            jsEnv.Dispose();
+            Assert.AreEqual(4, ret);
+            Assert.AreEqual(1, hits);
+            Assert.AreEqual(1, rejected);
+
+            Directory.Delete(cacheDir, true);
+        }
+
+        // a one entry bundle in the CodeCacheBundle.h layout, with the payload of a cache file written by SetModuleCodeCacheDir
+        static void WriteBundle(string cacheFile, string modulePath, string bundleFile)
+        {
+            byte[] cache = File.ReadAllBytes(cacheFile);
+            // cache file header: magic, version tag, source hash, payload length, reserved
+            uint versionTag = System.BitConverter.ToUInt32(cache, 4);
+            ulong sourceHash = System.BitConverter.ToUInt64(cache, 8);
+            int payloadLength = (int)System.BitConverter.ToUInt32(cache, 16);
+            byte[] path = Encoding.UTF8.GetBytes(modulePath);
+            int pathOffset = 16 + 32;
+            int payloadOffset = (pathOffset + path.Length + 15) & ~15;
+            using (var writer = new BinaryWriter(File.Create(bundleFile)))
+            {
+                writer.Write(0x42434356u);
+                writer.Write(2u);
+                writer.Write(1u);
+                writer.Write(versionTag);
+                writer.Write(sourceHash);
+                writer.Write((ulong)payloadOffset);
+                writer.Write((uint)payloadLength);
+                writer.Write((uint)pathOffset);
+                writer.Write((uint)path.Length);
+                writer.Write(1u);
+                writer.Write(path);
+                writer.Write(new byte[payloadOffset - pathOffset - path.Length]);
+                writer.Write(cache, 24, payloadLength);
+            }
+        }
+
+        [Test]
+        public void ModuleCodeCacheBundleHit()
+        {
+            var cacheDir = Path.Combine(Path.GetTempPath(), "puerts_code_cache_bundle_test");
+            if (Directory.Exists(cacheDir)) Directory.Delete(cacheDir, true);
+            Directory.CreateDirectory(cacheDir);
+
+            var loader = new UnitTestLoader2();
+            loader.AddMockFileContent("code-cache-bundle/single.mjs", @"
+                export const result = 40 + 2;
+            ");
+
+            int hits, misses, rejected;
+            var jsEnv = new JsEnv(loader);
+            if (jsEnv.Backend is BackendQuickJS)
+            {
+                jsEnv.Dispose();
+                return;
+            }
+            Assert.False(jsEnv.SetModuleCodeCacheBundle(Path.Combine(cacheDir, "missing.bundle")));
+            jsEnv.SetModuleCodeCacheDir(cacheDir);
+            jsEnv.ExecuteModule("code-cache-bundle/single.mjs");
+            jsEnv.Dispose();
+            var cacheFiles = Directory.GetFiles(cacheDir);
+            Assert.AreEqual(1, cacheFiles.Length);
+            var bundleFile = Path.Combine(cacheDir, "modules.bundle");
+            WriteBundle(cacheFiles[0], "code-cache-bundle/single.mjs", bundleFile);
+
+            jsEnv = new JsEnv(loader);
+            Assert.True(jsEnv.SetModuleCodeCacheBundle(bundleFile));
+            var ret = jsEnv.ExecuteModule<int>("code-cache-bundle/single.mjs", "result");
+            jsEnv.GetModuleCodeCacheStats(out hits, out misses, out rejected);
+            jsEnv.Dispose();
+            Assert.AreEqual(42, ret);
+            Assert.AreEqual(1, hits);
+            Assert.AreEqual(0, misses);
+
+            Directory.Delete(cacheDir, true);
+        }
+    }
+}
+#endif
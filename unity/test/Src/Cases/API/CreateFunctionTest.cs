@@ -0,0 +1,63 @@
+/*
+* Tencent is pleased to support the open source community by making Puerts available.
+* Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+* Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may be subject to their corresponding license terms.
+* This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this source code package.
+*/
+#if !UNITY_WEBGL && !PUERTS_IL2CPP_OPTIMIZATION
+using NUnit.Framework;
+
+namespace Puerts.UnitTest
+{
+    [UnityEngine.Scripting.Preserve]
+    public class CreateFunctionTestHelper
+    {
+        [UnityEngine.Scripting.Preserve] public static int Add(int a, int b)
+        {
+            return a + b;
+        }
+    }
+
+    [TestFixture]
+    public class CreateFunctionTest
+    {
+        [Test]
+        public void CreateAndDropManyFunctions()
+        {
+            var jsEnv = UnitTestEnv.GetEnv();
+
+            // every function is dropped right away, the native side has to forget its callback data
+            // when the function is collected, with a million of them that must not be a linear search each
+            int ret = jsEnv.Eval<int>(@"
+                (function() {
+                    const method = puer.$typeof(CS.Puerts.UnitTest.CreateFunctionTestHelper).GetMethod('Add');
+                    let sum = 0;
+                    for (let i = 0; i < 1000000; i++) {
+                        const func = puer.createFunction(method);
+                        if (i % 100000 == 0) {
+                            sum = func(sum, 1);
+                        }
+                    }
+                    return sum;
+                })();
+            ");
+            Assert.AreEqual(10, ret);
+
+            if (jsEnv.Backend is BackendV8)
+            {
+                jsEnv.Eval("gc()");
+            }
+
+            jsEnv.Tick();
+
+            int ret2 = jsEnv.Eval<int>(@"
+                (function() {
+                    const method = puer.$typeof(CS.Puerts.UnitTest.CreateFunctionTestHelper).GetMethod('Add');
+                    return puer.createFunction(method)(20, 3);
+                })();
+            ");
+            Assert.AreEqual(23, ret2);
+        }
+    }
+}
+#endif
@@ -0,0 +1,143 @@
+/*
+* Tencent is pleased to support the open source community by making Puerts available.
+* Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+* Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may be subject to their corresponding license terms.
+* This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this source code package.
+*/
+#if !UNITY_WEBGL && !PUERTS_IL2CPP_OPTIMIZATION
+using System;
+using NUnit.Framework;
+
+namespace Puerts.UnitTest
+{
+    [UnityEngine.Scripting.Preserve]
+    public class InvokeWithArgumentsTestHelper
+    {
+        [UnityEngine.Scripting.Preserve] public int Value;
+
+        public static Func<string, double, string> Inner;
+
+        [UnityEngine.Scripting.Preserve] public static string CallInner(string a, double b)
+        {
+            return Inner(a, b);
+        }
+    }
+
+    // js functions converted to delegates pass their arguments to native in one block
+    [TestFixture]
+    public class InvokeWithArgumentsTest
+    {
+        [Test]
+        public void PrimitiveArguments()
+        {
+            var jsEnv = UnitTestEnv.GetEnv();
+            var func = jsEnv.Eval<Func<double, long, bool, string, string>>(@"
+                (function(a, b, c, d) {
+                    return `${typeof a}:${a}|${typeof b}:${b}|${typeof c}:${c}|${typeof d}:${d}`;
+                })
+            ");
+            Assert.AreEqual("number:1.5|bigint:9007199254740993|boolean:true|string:中文abc",
+                func(1.5, 9007199254740993L, true, "中文abc"));
+            Assert.AreEqual("number:-1|bigint:-1|boolean:false|string:", func(-1, -1, false, ""));
+            jsEnv.Tick();
+        }
+
+        [Test]
+        public void NullArguments()
+        {
+            var jsEnv = UnitTestEnv.GetEnv();
+            var func = jsEnv.Eval<Func<string, InvokeWithArgumentsTestHelper, ArrayBuffer, string>>(@"
+                (function(a, b, c) {
+                    return `${a === null || a === undefined}|${b === null || b === undefined}|${c instanceof ArrayBuffer ? c.byteLength : c}`;
+                })
+            ");
+            Assert.AreEqual("true|true|0", func(null, null, null));
+            jsEnv.Tick();
+        }
+
+        [Test]
+        public void ObjectArguments()
+        {
+            var jsEnv = UnitTestEnv.GetEnv();
+            var obj = jsEnv.Eval<JSObject>("globalThis.__invokeWithArgumentsObj = { tag: 'obj' }");
+            var func = jsEnv.Eval<Func<InvokeWithArgumentsTestHelper, JSObject, InvokeWithArgumentsTestHelper, string>>(@"
+                (function(a, b, c) {
+                    return `${a.Value}|${b === globalThis.__invokeWithArgumentsObj}|${b.tag}|${a === c}`;
+                })
+            ");
+            var helper = new InvokeWithArgumentsTestHelper { Value = 42 };
+            Assert.AreEqual("42|true|obj|true", func(helper, obj, helper));
+            jsEnv.Eval("delete globalThis.__invokeWithArgumentsObj");
+            jsEnv.Tick();
+        }
+
+        [Test]
+        public void ArrayBufferIsCopied()
+        {
+            var jsEnv = UnitTestEnv.GetEnv();
+            var func = jsEnv.Eval<Func<ArrayBuffer, int>>(@"
+                (function(buffer) {
+                    const view = new Uint8Array(buffer);
+                    view[0] = 100;
+                    return view.length * 1000 + view[1];
+                })
+            ");
+            var bytes = new byte[4] { 1, 2, 3, 4 };
+            Assert.AreEqual(3002, func(new ArrayBuffer(bytes, 3)));
+            Assert.AreEqual(1, bytes[0]);
+            jsEnv.Tick();
+        }
+
+        [Test]
+        public void SharedArrayBufferIsWritable()
+        {
+            var jsEnv = UnitTestEnv.GetEnv();
+            // quickjs has no external backing store and falls back to a copy
+            if (jsEnv.Backend is BackendQuickJS) return;
+            var func = jsEnv.Eval<Func<ArrayBuffer, int>>(@"
+                (function(buffer) {
+                    const view = new Uint8Array(buffer);
+                    view[0] = 100;
+                    return view[3];
+                })
+            ");
+            var bytes = new byte[4] { 1, 2, 3, 4 };
+            Assert.AreEqual(4, func(new ArrayBuffer(bytes, bytes.Length, true)));
+            Assert.AreEqual(100, bytes[0]);
+            jsEnv.Tick();
+        }
+
+        [Test]
+        public void ArgumentBufferGrows()
+        {
+            var jsEnv = UnitTestEnv.GetEnv();
+            var func = jsEnv.Eval<Func<string, ArrayBuffer, string, string>>(@"
+                (function(a, b, c) {
+                    return `${a.length}|${b.byteLength}|${new Uint8Array(b)[999]}|${c}`;
+                })
+            ");
+            var bytes = new byte[1000];
+            bytes[999] = 7;
+            string longString = new string('中', 300);
+            Assert.AreEqual("300|1000|7|tail", func(longString, new ArrayBuffer(bytes), "tail"));
+            Assert.AreEqual("300|1000|7|tail", func(longString, new ArrayBuffer(bytes), "tail"));
+            jsEnv.Tick();
+        }
+
+        [Test]
+        public void NestedInvoke()
+        {
+            var jsEnv = UnitTestEnv.GetEnv();
+            InvokeWithArgumentsTestHelper.Inner = jsEnv.Eval<Func<string, double, string>>("(function(a, b) { return a + b; })");
+            var outer = jsEnv.Eval<Func<string, double, string>>(@"
+                (function(a, b) {
+                    return CS.Puerts.UnitTest.InvokeWithArgumentsTestHelper.CallInner(a, 1) + '|' + a + b;
+                })
+            ");
+            Assert.AreEqual("x1|x2", outer("x", 2));
+            InvokeWithArgumentsTestHelper.Inner = null;
+            jsEnv.Tick();
+        }
+    }
+}
+#endif
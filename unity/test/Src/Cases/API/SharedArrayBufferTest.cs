@@ -0,0 +1,75 @@
+/*
+* Tencent is pleased to support the open source community by making Puerts available.
+* Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+* Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may be subject to their corresponding license terms.
+* This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this source code package.
+*/
+#if !UNITY_WEBGL && !PUERTS_IL2CPP_OPTIMIZATION
+using System;
+using NUnit.Framework;
+
+namespace Puerts.UnitTest
+{
+    [UnityEngine.Scripting.Preserve]
+    public class SharedArrayBufferTestHelper
+    {
+        public static byte[] Storage = new byte[4] { 1, 2, 3, 4 };
+
+        public static WeakReference Temporary;
+
+        [UnityEngine.Scripting.Preserve] public static ArrayBuffer GetShared()
+        {
+            return new ArrayBuffer(Storage, Storage.Length, true);
+        }
+
+        [UnityEngine.Scripting.Preserve] public static ArrayBuffer GetTemporary()
+        {
+            var bytes = new byte[16];
+            Temporary = new WeakReference(bytes);
+            return new ArrayBuffer(bytes, bytes.Length, true);
+        }
+    }
+
+    [TestFixture]
+    public class SharedArrayBufferTest
+    {
+        [Test]
+        public void JSWritesAreVisibleInCS()
+        {
+            var jsEnv = UnitTestEnv.GetEnv();
+            // quickjs has no external backing store and falls back to a copy
+            if (jsEnv.Backend is BackendQuickJS) return;
+            int ret = jsEnv.Eval<int>(@"
+                (function() {
+                    const view = new Uint8Array(CS.Puerts.UnitTest.SharedArrayBufferTestHelper.GetShared());
+                    view[0] = 100;
+                    return view[3];
+                })()
+            ");
+            Assert.AreEqual(4, ret);
+            Assert.AreEqual(100, SharedArrayBufferTestHelper.Storage[0]);
+            SharedArrayBufferTestHelper.Storage[0] = 1;
+        }
+
+        [Test]
+        public void PinIsReleasedOnTick()
+        {
+            var jsEnv = UnitTestEnv.GetEnv();
+            var backend = jsEnv.Backend as BackendV8;
+            if (backend == null) return;
+            jsEnv.Eval("new Uint8Array(CS.Puerts.UnitTest.SharedArrayBufferTestHelper.GetTemporary())[0] = 1;");
+            // v8 may free the backing store on a background thread, the pin is only released by a later tick
+            for (int i = 0; i < 100 && SharedArrayBufferTestHelper.Temporary.IsAlive; i++)
+            {
+                backend.RequestFullGarbageCollectionForTesting();
+                jsEnv.Tick();
+                GC.Collect();
+                GC.WaitForPendingFinalizers();
+                System.Threading.Thread.Sleep(10);
+            }
+            Assert.False(SharedArrayBufferTestHelper.Temporary.IsAlive);
+            SharedArrayBufferTestHelper.Temporary = null;
+        }
+    }
+}
+#endif
@@ -3,9 +3,20 @@
 #include <sstream>
 #include <map>
 #include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <memory>
+// directory input for --batch, a list file works with every standard
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#include <filesystem>
+#define V8CC_WITH_FILESYSTEM 1
+#endif
 
 #include "libplatform/libplatform.h"
 #include "v8.h"
+#include "CodeCacheBundle.h"
 
 bool endsWith(const std::string &fullString, const std::string &ending) {
     if (fullString.length() >= ending.length()) {
@@ -50,23 +61,267 @@ struct CodeCacheHeader {
     uint32_t Checksum;
 };
 
+struct CompileOptions {
+    bool is_module;
+    bool no_cjs_wrap;
+    std::string url;
+    int ln;
+    int col;
+};
+
+// text mode like before for single files, batch sources are read as bytes so their hash matches what a loader returns
+bool readFile(const std::string& filename, std::string& content, bool binary = false) {
+    std::ifstream file(filename, binary ? std::ios::in | std::ios::binary : std::ios::in);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    content = buffer.str();
+    return true;
+}
+
+// compile in the current context, returns nullptr and prints the stack on failure
+v8::ScriptCompiler::CachedData* CompileToCodeCache(v8::Isolate* isolate, v8::Local<v8::Context> context, std::string fileContent,
+                                                   const CompileOptions& options, int* source_length) {
+    v8::HandleScope handle_scope(isolate);
+    v8::TryCatch try_catch(isolate);
+    v8::ScriptCompiler::CachedData* cached_data = nullptr;
+    auto script_url = v8::String::NewFromUtf8(isolate, options.url.c_str()).ToLocalChecked();
+    if (!options.is_module && !options.no_cjs_wrap) {
+        fileContent = "(function (exports, require, module, __filename, __dirname) { " + fileContent + "\n});";
+    }
+    v8::Local<v8::String> source =
+        v8::String::NewFromUtf8(isolate, fileContent.c_str(), v8::NewStringType::kNormal, static_cast<int>(fileContent.size())).ToLocalChecked();
+    if (source_length) {
+        *source_length = source->Length();
+    }
+    if (options.is_module) {
+#if V8_MAJOR_VERSION > 8
+        v8::ScriptOrigin origin(isolate, script_url, options.ln, options.col, true, -1, v8::Local<v8::Value>(), false, false, true);
+#else
+        v8::ScriptOrigin origin(script_url, v8::Integer::New(isolate, options.ln), v8::Integer::New(isolate, options.col), v8::True(isolate),
+            v8::Local<v8::Integer>(), v8::Local<v8::Value>(), v8::False(isolate), v8::False(isolate), v8::True(isolate));
+#endif
+        auto module = CompileString<v8::Module>(context, source, origin);
+
+        if (!module.IsEmpty()) {
+            cached_data = v8::ScriptCompiler::CreateCodeCache(module.ToLocalChecked()->GetUnboundModuleScript());
+        }
+    } else {
+#if V8_MAJOR_VERSION > 8
+        v8::ScriptOrigin origin(isolate, script_url, options.ln, options.col);
+#else
+        v8::ScriptOrigin origin(script_url, v8::Integer::New(isolate, options.ln), v8::Integer::New(isolate, options.col));
+#endif
+
+        auto script = CompileString<v8::Script>(context, source, origin);
+        if (!script.IsEmpty()) {
+            cached_data = v8::ScriptCompiler::CreateCodeCache(script.ToLocalChecked()->GetUnboundScript());
+        }
+    }
+    if (try_catch.HasCaught()) {
+        v8::Local<v8::Value> stack_trace;
+        if (try_catch.StackTrace(context).ToLocal(&stack_trace))
+        {
+            v8::String::Utf8Value info(isolate, stack_trace);
+            std::cout << options.url << ": " << (*info) << std::endl;
+        }
+        delete cached_data;
+        return nullptr;
+    }
+    return cached_data;
+}
+
+struct BatchItem {
+    std::string path;      // as read from disk
+    std::string key;       // path stored in the bundle, relative to the batch root
+    uint64_t source_hash = 0;
+    uint32_t flags = 0;
+    std::unique_ptr<v8::ScriptCompiler::CachedData> cached_data;
+};
+
+bool collectBatchItems(const std::string& input, std::vector<BatchItem>& items) {
+#if V8CC_WITH_FILESYSTEM
+    namespace fs = std::filesystem;
+    std::error_code ec;
+    if (fs::is_directory(input, ec)) {
+        fs::path root(input);
+        for (auto it = fs::recursive_directory_iterator(root, ec); !ec && it != fs::recursive_directory_iterator(); it.increment(ec)) {
+            if (!it->is_regular_file()) continue;
+            std::string path = it->path().generic_string();
+            if (!endsWith(path, ".js") && !endsWith(path, ".mjs") && !endsWith(path, ".cjs")) continue;
+            BatchItem item;
+            item.path = path;
+            item.key = fs::relative(it->path(), root).generic_string();
+            items.push_back(std::move(item));
+        }
+        return !ec;
+    }
+#endif
+    // otherwise a list file, one path per line, used as is for the bundle key
+    std::string list;
+    if (!readFile(input, list)) {
+        return false;
+    }
+    std::istringstream lines(list);
+    std::string line;
+    while (std::getline(lines, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty()) continue;
+        BatchItem item;
+        item.path = line;
+        item.key = line;
+        items.push_back(std::move(item));
+    }
+    return true;
+}
+
+bool writeBundle(const std::string& output_filename, std::vector<BatchItem>& items) {
+    std::sort(items.begin(), items.end(), [](const BatchItem& a, const BatchItem& b) { return a.key < b.key; });
+
+    auto align = [](uint64_t offset) {
+        return (offset + kCodeCacheBundleAlignment - 1) & ~static_cast<uint64_t>(kCodeCacheBundleAlignment - 1);
+    };
+
+    CodeCacheBundleHeader header = {kCodeCacheBundleMagic, kCodeCacheBundleVersion, static_cast<uint32_t>(items.size()),
+                                    v8::ScriptCompiler::CachedDataVersionTag()};
+    std::vector<CodeCacheBundleEntry> entries(items.size());
+    uint64_t offset = sizeof(header) + sizeof(CodeCacheBundleEntry) * items.size();
+    for (size_t i = 0; i < items.size(); ++i) {
+        entries[i].PathOffset = static_cast<uint32_t>(offset);
+        entries[i].PathLength = static_cast<uint32_t>(items[i].key.size());
+        offset += items[i].key.size();
+    }
+    for (size_t i = 0; i < items.size(); ++i) {
+        offset = align(offset);
+        entries[i].SourceHash = items[i].source_hash;
+        entries[i].Flags = items[i].flags;
+        entries[i].PayloadOffset = offset;
+        entries[i].PayloadLength = static_cast<uint32_t>(items[i].cached_data->length);
+        offset += items[i].cached_data->length;
+    }
+
+    std::ofstream output_file(output_filename, std::ios::binary);
+    if (!output_file.is_open()) {
+        std::cerr << "Error creating file: " << output_filename << std::endl;
+        return false;
+    }
+    output_file.write((const char*)&header, sizeof(header));
+    output_file.write((const char*)entries.data(), sizeof(CodeCacheBundleEntry) * entries.size());
+    for (auto& item : items) {
+        output_file.write(item.key.data(), item.key.size());
+    }
+    uint64_t written = entries.empty() ? sizeof(header) : entries.back().PathOffset + entries.back().PathLength;
+    static const char padding[kCodeCacheBundleAlignment] = {0};
+    for (size_t i = 0; i < items.size(); ++i) {
+        output_file.write(padding, entries[i].PayloadOffset - written);
+        output_file.write((const char*)items[i].cached_data->data, items[i].cached_data->length);
+        written = entries[i].PayloadOffset + entries[i].PayloadLength;
+    }
+    return output_file.good();
+}
+
+// compile every file of the batch on `jobs` worker isolates and write them into one bundle
+int RunBatch(const std::string& input, const std::string& output_filename, int jobs, const CompileOptions& base_options, bool verbose) {
+    std::vector<BatchItem> items;
+    if (!collectBatchItems(input, items)) {
+        std::cerr << "Error reading batch input: " << input << std::endl;
+        return 1;
+    }
+
+    std::atomic<size_t> next(0);
+    std::atomic<bool> failed(false);
+    auto worker = [&]() {
+        v8::Isolate::CreateParams create_params;
+        create_params.array_buffer_allocator = v8::ArrayBuffer::Allocator::NewDefaultAllocator();
+        v8::Isolate* isolate = v8::Isolate::New(create_params);
+        {
+            v8::Isolate::Scope isolate_scope(isolate);
+            v8::HandleScope handle_scope(isolate);
+            v8::Local<v8::Context> context = v8::Context::New(isolate);
+            v8::Context::Scope context_scope(context);
+            for (size_t i = next++; i < items.size() && !failed; i = next++) {
+                BatchItem& item = items[i];
+                std::string content;
+                if (!readFile(item.path, content, true)) {
+                    std::cerr << "Error opening file: " << item.path << std::endl;
+                    failed = true;
+                    break;
+                }
+                CompileOptions options = base_options;
+                options.is_module = base_options.is_module || endsWith(item.path, ".mjs");
+                options.url = item.key;
+                item.source_hash = CodeCacheBundleHash(content.data(), content.size());
+                item.flags = (options.is_module ? kCodeCacheBundleModule : 0) |
+                             (!options.is_module && !options.no_cjs_wrap ? kCodeCacheBundleCjsWrapped : 0);
+                item.cached_data.reset(CompileToCodeCache(isolate, context, content, options, nullptr));
+                if (!item.cached_data) {
+                    failed = true;
+                    break;
+                }
+                if (verbose) {
+                    std::cout << "compiled: " << item.key << ", bytecode length: " << item.cached_data->length << std::endl;
+                }
+            }
+        }
+        isolate->Dispose();
+        delete create_params.array_buffer_allocator;
+    };
+
+    jobs = std::max(1, std::min(jobs, static_cast<int>(items.size())));
+    std::vector<std::thread> workers;
+    for (int i = 0; i < jobs; ++i) {
+        workers.emplace_back(worker);
+    }
+    for (auto& t : workers) {
+        t.join();
+    }
+    if (failed) {
+        return 1;
+    }
+
+    if (!writeBundle(output_filename, items)) {
+        return 1;
+    }
+    if (verbose) {
+        std::cout << "bundle: " << output_filename << ", files: " << items.size() << ", jobs: " << jobs << std::endl;
+    }
+    return 0;
+}
+
 int main(int argc, char* argv[]) {
     if (argc < 2) {
         std::cerr << "Usage: " << argv[0] << " <filename> [--module] [--no-cjs-wrap] [--verbose] [--url=<string>] [--ln=<number>] [--col=<number>] [v8_flag1] [v8_flag2] ..." << std::endl;
+        std::cerr << "       " << argv[0] << " --batch=<dir|listfile> --bundle=<output> [--jobs=<number>] [--module] [--no-cjs-wrap] [--verbose] [v8_flag1] ..." << std::endl;
         return 1;
     }
 
     std::string filename = argv[1];
-    bool is_module = endsWith(filename, ".mjs");
+    std::string batch_input;
+    if (filename.rfind("--batch=", 0) == 0) {
+        batch_input = filename.substr(8);
+    }
+    bool is_module = batch_input.empty() && endsWith(filename, ".mjs");
     bool no_cjs_wrap = false;
     bool verbose = false;
     std::string flags = "--no-lazy --no-flush-bytecode --no-enable-lazy-source-positions";
     std::string url = filename;
+    std::string bundle_filename;
+    int jobs = static_cast<int>(std::thread::hardware_concurrency());
     int ln = 0;
     int col = 0;
     if (argc > 2) {
         for (int i = 2; i < argc; ++i) {
             std::string arg = argv[i];
+            if (arg.rfind("--bundle=", 0) == 0) {
+                bundle_filename = arg.substr(9);
+                continue;
+            }
+            if (arg.rfind("--jobs=", 0) == 0) {
+                jobs = std::stoi(arg.substr(7));
+                continue;
+            }
             if (arg == "--module") {
                 is_module = true;
                 continue;
@@ -94,22 +349,35 @@ int main(int argc, char* argv[]) {
             flags += (" " + arg);
         }
     }
+
+    if (!batch_input.empty()) {
+        if (bundle_filename.empty()) {
+            std::cerr << "--batch requires --bundle=<output>" << std::endl;
+            return 1;
+        }
+        v8::V8::SetFlagsFromString(flags.c_str(), flags.size());
+        std::unique_ptr<v8::Platform> platform = v8::platform::NewDefaultPlatform();
+        v8::V8::InitializePlatform(platform.get());
+        v8::V8::Initialize();
+        CompileOptions options = {is_module, no_cjs_wrap, std::string(), ln, col};
+        int ret = RunBatch(batch_input, bundle_filename, jobs, options, verbose);
+        v8::V8::Dispose();
+#if V8_MAJOR_VERSION > 9
+        v8::V8::DisposePlatform();
+#else
+        v8::V8::ShutdownPlatform();
+#endif
+        return ret;
+    }
     
-    std::ifstream file(filename);
-    if (!file.is_open()) {
+    std::string fileContent;
+    if (!readFile(filename, fileContent)) {
         std::cerr << "Error opening file: " << filename << std::endl;
         return 1;
     }
-
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-
-    std::string fileContent = buffer.str();
     
     v8::V8::SetFlagsFromString(flags.c_str(), flags.size());
     
-    file.close();
-    
     v8::ScriptCompiler::CachedData* cached_data = nullptr;
     // --- begin get code cache ---
     std::unique_ptr<v8::Platform> platform = v8::platform::NewDefaultPlatform();
@@ -127,45 +395,9 @@ int main(int argc, char* argv[]) {
         v8::HandleScope handle_scope(isolate);
         v8::Local<v8::Context> context = v8::Context::New(isolate);
         v8::Context::Scope context_scope(context);
-        v8::TryCatch try_catch(isolate);
-        auto script_url = v8::String::NewFromUtf8(isolate, url.c_str()).ToLocalChecked();
-        if (!is_module && !no_cjs_wrap) {
-            fileContent = "(function (exports, require, module, __filename, __dirname) { " + fileContent + "\n});";
-        }
-        v8::Local<v8::String> source =
-            v8::String::NewFromUtf8(isolate, fileContent.c_str()).ToLocalChecked();
-        source_length = source->Length();
-        if (is_module) {
-#if V8_MAJOR_VERSION > 8
-            v8::ScriptOrigin origin(isolate, script_url, ln, col, true, -1, v8::Local<v8::Value>(), false, false, true);
-#else
-            v8::ScriptOrigin origin(script_url, v8::Integer::New(isolate, ln), v8::Integer::New(isolate, col), v8::True(isolate),
-                v8::Local<v8::Integer>(), v8::Local<v8::Value>(), v8::False(isolate), v8::False(isolate), v8::True(isolate));
-#endif
-            auto module = CompileString<v8::Module>(context, source, origin);
-            
-            if (!module.IsEmpty()) {
-                cached_data = v8::ScriptCompiler::CreateCodeCache(module.ToLocalChecked()->GetUnboundModuleScript());
-            }
-        } else {
-#if V8_MAJOR_VERSION > 8
-            v8::ScriptOrigin origin(isolate, script_url, ln, col);
-#else
-            v8::ScriptOrigin origin(script_url, v8::Integer::New(isolate, ln), v8::Integer::New(isolate, col));
-#endif
-            
-            auto script = CompileString<v8::Script>(context, source, origin);
-            if (!script.IsEmpty()) {
-                cached_data = v8::ScriptCompiler::CreateCodeCache(script.ToLocalChecked()->GetUnboundScript());
-            }
-        }
-        if (try_catch.HasCaught()) {
-            v8::Local<v8::Value> stack_trace;
-            if (try_catch.StackTrace(context).ToLocal(&stack_trace))
-            {
-                v8::String::Utf8Value info(isolate, stack_trace);
-                std::cout << (*info) << std::endl;
-            }
+        CompileOptions options = {is_module, no_cjs_wrap, url, ln, col};
+        cached_data = CompileToCodeCache(isolate, context, fileContent, options, &source_length);
+        if (!cached_data) {
             return 1;
         }
     }
@@ -43,6 +43,9 @@ public class JsEnv : ModuleRules
     private bool ThreadSafe = false;
 
     private bool FTextAsString = true;
+
+    // FString/FText of at least this many characters become external v8 strings, 0 disables it
+    private int ExternalStringThreshold = 0;
     
     private bool bEditorSuffix = true;
 
@@ -83,6 +86,11 @@ public class JsEnv : ModuleRules
             PublicDefinitions.Add("PUERTS_FTEXT_AS_OBJECT");
         }
 
+        if (ExternalStringThreshold > 0 && !UseQuickjs)
+        {
+            PublicDefinitions.Add("PUERTS_EXTERNAL_STRING_THRESHOLD=" + ExternalStringThreshold);
+        }
+
         PublicDependencyModuleNames.AddRange(new string[]
         {
             "Core", "CoreUObject", "Engine", "ParamDefaultValueMetas", "UMG"
@@ -28,6 +28,12 @@ v8::Local<v8::FunctionTemplate> FScriptArrayWrapper::ToFunctionTemplate(v8::Isol
     Result->PrototypeTemplate()->Set(
         FV8Utils::InternalString(Isolate, "IsValidIndex"), v8::FunctionTemplate::New(Isolate, IsValidIndex));
     Result->PrototypeTemplate()->Set(FV8Utils::InternalString(Isolate, "Empty"), v8::FunctionTemplate::New(Isolate, Empty));
+#ifndef WITH_QUICKJS
+    Result->PrototypeTemplate()->Set(
+        FV8Utils::InternalString(Isolate, "AsTypedArray"), v8::FunctionTemplate::New(Isolate, AsTypedArray));
+    Result->PrototypeTemplate()->Set(FV8Utils::InternalString(Isolate, "CopyFrom"), v8::FunctionTemplate::New(Isolate, CopyFrom));
+    Result->PrototypeTemplate()->Set(FV8Utils::InternalString(Isolate, "CopyTo"), v8::FunctionTemplate::New(Isolate, CopyTo));
+#endif
 
     return Result;
 }
@@ -204,6 +210,266 @@ void FScriptArrayWrapper::Empty(const v8::FunctionCallbackInfo<v8::Value>& Info)
     FScriptArrayEx::Empty(Self, Inner->Property);
 }
 
+#ifndef WITH_QUICKJS
+
+static int32 GetViewTypeSize(EArrayViewType Type)
+{
+    switch (Type)
+    {
+        case EArrayViewType::Int8:
+        case EArrayViewType::UInt8:
+            return 1;
+        case EArrayViewType::Int16:
+        case EArrayViewType::UInt16:
+            return 2;
+        case EArrayViewType::Int32:
+        case EArrayViewType::UInt32:
+        case EArrayViewType::Float:
+            return 4;
+        case EArrayViewType::Double:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+static v8::Local<v8::TypedArray> NewTypedArray(v8::Local<v8::ArrayBuffer> Buffer, EArrayViewType Type, size_t Length)
+{
+    switch (Type)
+    {
+        case EArrayViewType::Int8:
+            return v8::Int8Array::New(Buffer, 0, Length);
+        case EArrayViewType::UInt8:
+            return v8::Uint8Array::New(Buffer, 0, Length);
+        case EArrayViewType::Int16:
+            return v8::Int16Array::New(Buffer, 0, Length);
+        case EArrayViewType::UInt16:
+            return v8::Uint16Array::New(Buffer, 0, Length);
+        case EArrayViewType::Int32:
+            return v8::Int32Array::New(Buffer, 0, Length);
+        case EArrayViewType::UInt32:
+            return v8::Uint32Array::New(Buffer, 0, Length);
+        case EArrayViewType::Float:
+            return v8::Float32Array::New(Buffer, 0, Length);
+        default:
+            return v8::Float64Array::New(Buffer, 0, Length);
+    }
+}
+
+static bool IsTypedArrayOf(v8::Local<v8::Value> Value, EArrayViewType Type)
+{
+    switch (Type)
+    {
+        case EArrayViewType::Int8:
+            return Value->IsInt8Array();
+        case EArrayViewType::UInt8:
+            return Value->IsUint8Array();
+        case EArrayViewType::Int16:
+            return Value->IsInt16Array();
+        case EArrayViewType::UInt16:
+            return Value->IsUint16Array();
+        case EArrayViewType::Int32:
+            return Value->IsInt32Array();
+        case EArrayViewType::UInt32:
+            return Value->IsUint32Array();
+        case EArrayViewType::Float:
+            return Value->IsFloat32Array();
+        case EArrayViewType::Double:
+            return Value->IsFloat64Array();
+        default:
+            return false;
+    }
+}
+
+void FScriptArrayWrapper::AsTypedArray(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+    v8::Isolate* Isolate = Info.GetIsolate();
+    v8::HandleScope HandleScope(Isolate);
+
+    auto Self = FV8Utils::GetPointerFast<FScriptArray>(Info.Holder(), 0);
+    auto Inner = FV8Utils::GetPointerFast<FPropertyTranslator>(Info.Holder(), 1);
+    EArrayViewType Type;
+    int32 Components;
+    if (!CheckViewType(Isolate, Inner, Type, Components))
+    {
+        return;
+    }
+
+    // a copy: the allocation can be moved or freed from C++ (or with the owner) while js still holds the result,
+    // and nothing would tell a view over it
+    const size_t Length = static_cast<size_t>(Self->Num()) * Components;
+    const size_t ByteLength = Length * GetViewTypeSize(Type);
+    auto Buffer = v8::ArrayBuffer::New(Isolate, ByteLength);
+    if (ByteLength > 0)
+    {
+        FMemory::Memcpy(DataTransfer::GetArrayBufferData(Buffer), Self->GetData(), ByteLength);
+    }
+    Info.GetReturnValue().Set(NewTypedArray(Buffer, Type, Length));
+}
+
+void FScriptArrayWrapper::CopyFrom(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+    v8::Isolate* Isolate = Info.GetIsolate();
+    v8::HandleScope HandleScope(Isolate);
+    v8::Local<v8::Context> Context = Isolate->GetCurrentContext();
+
+    CHECK_V8_ARGS_LEN(1);
+
+    auto Self = FV8Utils::GetPointerFast<FScriptArray>(Info.Holder(), 0);
+    auto Inner = FV8Utils::GetPointerFast<FPropertyTranslator>(Info.Holder(), 1);
+    EArrayViewType Type;
+    int32 Components;
+    if (!CheckViewType(Isolate, Inner, Type, Components))
+    {
+        return;
+    }
+    if (!IsTypedArrayOf(Info[0], Type))
+    {
+        FV8Utils::ThrowException(Isolate, "TypedArray type mismatch");
+        return;
+    }
+    auto Source = Info[0].As<v8::TypedArray>();
+    if (Source->Length() % Components != 0)
+    {
+        FV8Utils::ThrowException(Isolate, "TypedArray length is not a multiple of the element components");
+        return;
+    }
+
+    const int32 Count = static_cast<int32>(Source->Length() / Components);
+    const int32 ElementSize = GetSizeWithAlignment(Inner->Property);
+    if (Count > Self->Num())
+    {
+        AddUninitialized(Self, ElementSize, Count - Self->Num());
+    }
+    else if (Count < Self->Num())
+    {
+#if ENGINE_MAJOR_VERSION > 4
+        Self->Remove(Count, Self->Num() - Count, ElementSize, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+#else
+        Self->Remove(Count, Self->Num() - Count, ElementSize);
+#endif
+    }
+
+    if (Count > 0)
+    {
+        Source->CopyContents(Self->GetData(), Count * ElementSize);
+    }
+}
+
+void FScriptArrayWrapper::CopyTo(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+    v8::Isolate* Isolate = Info.GetIsolate();
+    v8::HandleScope HandleScope(Isolate);
+    v8::Local<v8::Context> Context = Isolate->GetCurrentContext();
+
+    CHECK_V8_ARGS_LEN(1);
+
+    auto Self = FV8Utils::GetPointerFast<FScriptArray>(Info.Holder(), 0);
+    auto Inner = FV8Utils::GetPointerFast<FPropertyTranslator>(Info.Holder(), 1);
+    EArrayViewType Type;
+    int32 Components;
+    if (!CheckViewType(Isolate, Inner, Type, Components))
+    {
+        return;
+    }
+    if (!IsTypedArrayOf(Info[0], Type))
+    {
+        FV8Utils::ThrowException(Isolate, "TypedArray type mismatch");
+        return;
+    }
+    auto Target = Info[0].As<v8::TypedArray>();
+
+    const int32 Count = static_cast<int32>(FMath::Min<size_t>(Target->Length() / Components, Self->Num()));
+    if (Count > 0)
+    {
+        uint8* Dest = static_cast<uint8*>(DataTransfer::GetArrayBufferData(Target->Buffer())) + Target->ByteOffset();
+        FMemory::Memcpy(Dest, Self->GetData(), Count * GetSizeWithAlignment(Inner->Property));
+    }
+    Info.GetReturnValue().Set(Count);
+}
+
+EArrayViewType FScriptArrayWrapper::GetViewType(PropertyMacro* Property, int32& OutComponents)
+{
+    OutComponents = 1;
+    if (Property->IsA<FloatPropertyMacro>())
+    {
+        return EArrayViewType::Float;
+    }
+    if (Property->IsA<DoublePropertyMacro>())
+    {
+        return EArrayViewType::Double;
+    }
+    if (Property->IsA<IntPropertyMacro>())
+    {
+        return EArrayViewType::Int32;
+    }
+    if (Property->IsA<UInt32PropertyMacro>())
+    {
+        return EArrayViewType::UInt32;
+    }
+    if (Property->IsA<Int16PropertyMacro>())
+    {
+        return EArrayViewType::Int16;
+    }
+    if (Property->IsA<UInt16PropertyMacro>())
+    {
+        return EArrayViewType::UInt16;
+    }
+    if (Property->IsA<Int8PropertyMacro>())
+    {
+        return EArrayViewType::Int8;
+    }
+    if (Property->IsA<BytePropertyMacro>())
+    {
+        return EArrayViewType::UInt8;
+    }
+
+    auto StructProperty = CastFieldMacro<StructPropertyMacro>(Property);
+    if (!StructProperty || !(StructProperty->Struct->StructFlags & EStructFlags::STRUCT_IsPlainOldData))
+    {
+        return EArrayViewType::None;
+    }
+    // every member, nested structs included, has to be the same scalar type
+    EArrayViewType Type = EArrayViewType::None;
+    int32 Components = 0;
+    for (TFieldIterator<PropertyMacro> It(StructProperty->Struct); It; ++It)
+    {
+        int32 MemberComponents;
+        const EArrayViewType MemberType = GetViewType(*It, MemberComponents);
+        if (MemberType == EArrayViewType::None || (Type != EArrayViewType::None && MemberType != Type))
+        {
+            return EArrayViewType::None;
+        }
+        Type = MemberType;
+        Components += MemberComponents * It->ArrayDim;
+    }
+    // no padding between or after the members
+    if (Type == EArrayViewType::None || Components * GetViewTypeSize(Type) != StructProperty->Struct->GetStructureSize())
+    {
+        return EArrayViewType::None;
+    }
+    OutComponents = Components;
+    return Type;
+}
+
+bool FScriptArrayWrapper::CheckViewType(
+    v8::Isolate* Isolate, FPropertyTranslator* Inner, EArrayViewType& OutType, int32& OutComponents)
+{
+    if (!Inner->IsPropertyValid())
+    {
+        FV8Utils::ThrowException(Isolate, "item info is invalid!");
+        return false;
+    }
+    OutType = GetViewType(Inner->Property, OutComponents);
+    if (OutType == EArrayViewType::None || GetSizeWithAlignment(Inner->Property) != OutComponents * GetViewTypeSize(OutType))
+    {
+        FV8Utils::ThrowException(Isolate, "element type can not be accessed as TypedArray");
+        return false;
+    }
+    return true;
+}
+#endif
+
 FORCEINLINE int32 FScriptArrayWrapper::AddUninitialized(FScriptArray* ScriptArray, int32 ElementSize, int32 Count)
 {
 #if ENGINE_MAJOR_VERSION > 4
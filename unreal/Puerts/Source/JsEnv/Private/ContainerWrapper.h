@@ -274,6 +274,20 @@ public:
     }
 };
 
+// scalar type of a TypedArray view over TArray memory
+enum class EArrayViewType : uint8
+{
+    None,
+    Int8,
+    UInt8,
+    Int16,
+    UInt16,
+    Int32,
+    UInt32,
+    Float,
+    Double
+};
+
 class FScriptArrayWrapper : public FContainerWrapper<FScriptArray>
 {
 public:
@@ -325,6 +339,22 @@ private:
     // 作用：清空容器
     static void Empty(const v8::FunctionCallbackInfo<v8::Value>& Info);
 
+    // 参数：无
+    // 返回：容器内容的TypedArray拷贝（Float32Array、Int32Array等），结构体元素按成员平铺
+    // 作用：元素须为数值或只含同一种数值成员的POD结构体，否则抛出异常；
+    //       返回的是拷贝，修改后需用CopyFrom写回
+    static void AsTypedArray(const v8::FunctionCallbackInfo<v8::Value>& Info);
+
+    // 参数：元素类型对应的TypedArray
+    // 返回：无
+    // 作用：用TypedArray的内容整体替换容器内容，容器长度调整为对应的元素个数
+    static void CopyFrom(const v8::FunctionCallbackInfo<v8::Value>& Info);
+
+    // 参数：元素类型对应的TypedArray
+    // 返回：拷贝的元素个数
+    // 作用：把容器内容整体拷贝到TypedArray，放不下的部分被忽略
+    static void CopyTo(const v8::FunctionCallbackInfo<v8::Value>& Info);
+
     FORCEINLINE static int32 AddUninitialized(FScriptArray* ScriptArray, int32 ElementSize, int32 Count = 1);
 
     FORCEINLINE static uint8* GetData(FScriptArray* ScriptArray, int32 ElementSize, int32 Index);
@@ -334,6 +364,10 @@ private:
     static int32 FindIndexInner(const v8::FunctionCallbackInfo<v8::Value>& Info);
 
     FORCEINLINE static void InternalGet(const v8::FunctionCallbackInfo<v8::Value>& Info, bool PassByPointer);
+
+    static EArrayViewType GetViewType(PropertyMacro* Property, int32& OutComponents);
+
+    static bool CheckViewType(v8::Isolate* Isolate, FPropertyTranslator* Inner, EArrayViewType& OutType, int32& OutComponents);
 };
 
 class FScriptSetWrapper : public FContainerWrapper<FScriptSet>
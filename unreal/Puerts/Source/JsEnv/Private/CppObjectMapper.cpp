@@ -387,6 +387,7 @@ void FCppObjectMapper::UnBindCppObject(v8::Isolate* Isolate, JSClassDefinition*
 
 void FCppObjectMapper::UnInitialize(v8::Isolate* InIsolate)
 {
+    EndPesapiBatch(InIsolate);
     auto PData = DataTransfer::GetIsolatePrivateData(InIsolate);
     for (auto& KV : CDataCache)
     {
@@ -38,6 +38,9 @@ struct PointerEqual
         return lhs == rhs;
     }
 };
+// ends a pesapi batch (pesapi_begin_batch) this thread left open on Isolate, an entered isolate can not be disposed
+void EndPesapiBatch(v8::Isolate* Isolate);
+
 class FCppObjectMapper final : public ICppObjectMapper
 {
 public:
@@ -10,6 +10,7 @@
 #include "Misc/Paths.h"
 #include "Misc/FileHelper.h"
 #include "Algo/Reverse.h"
+#include "Misc/ScopeLock.h"
 #if (ENGINE_MAJOR_VERSION >= 5)
 #include "HAL/PlatformFileManager.h"
 #else
@@ -52,9 +53,8 @@ static FString PathNormalize(const FString& PathIn)
 
 bool DefaultJSModuleLoader::CheckExists(const FString& PathIn, FString& Path, FString& AbsolutePath)
 {
-    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
     FString NormalizedPath = PathNormalize(PathIn);
-    if (PlatformFile.FileExists(*NormalizedPath))
+    if (FileExists(NormalizedPath))
     {
         AbsolutePath = IFileManager::Get().ConvertToAbsolutePathForExternalAppForRead(*NormalizedPath);
         Path = NormalizedPath;
@@ -89,7 +89,86 @@ bool DefaultJSModuleLoader::SearchModuleWithExtInDir(
            (!Dir.EndsWith(TEXT("node_modules")) && CheckExists(Dir / TEXT("node_modules") / RequiredModule, Path, AbsolutePath));
 }
 
+bool DefaultJSModuleLoader::FileExists(const FString& NormalizedPath)
+{
+    // re-entrant, Search already holds it
+    FScopeLock ScopeLock(&CacheCritical);
+    if (bUseManifest)
+    {
+        return Manifest.Contains(NormalizedPath);
+    }
+    if (const bool* Exists = ExistsCache.Find(NormalizedPath))
+    {
+        return *Exists;
+    }
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    bool Exists = PlatformFile.FileExists(*NormalizedPath);
+    if (Exists || bCacheMisses)
+    {
+        ExistsCache.Add(NormalizedPath, Exists);
+    }
+    return Exists;
+}
+
+void DefaultJSModuleLoader::InvalidateSearchCache()
+{
+    FScopeLock ScopeLock(&CacheCritical);
+    SearchCache.Empty();
+    ExistsCache.Empty();
+}
+
+void DefaultJSModuleLoader::SetCacheMisses(bool bInCacheMisses)
+{
+    FScopeLock ScopeLock(&CacheCritical);
+    bCacheMisses = bInCacheMisses;
+    if (!bCacheMisses)
+    {
+        ExistsCache.Empty();
+    }
+}
+
+bool DefaultJSModuleLoader::LoadManifest(const FString& ManifestPath)
+{
+    TArray<FString> Lines;
+    if (!FFileHelper::LoadFileToStringArray(Lines, *ManifestPath))
+    {
+        return false;
+    }
+    FScopeLock ScopeLock(&CacheCritical);
+    Manifest.Empty(Lines.Num());
+    for (const FString& Line : Lines)
+    {
+        FString File = Line.TrimStartAndEnd();
+        if (!File.IsEmpty())
+        {
+            Manifest.Add(PathNormalize(FPaths::ProjectContentDir() / File));
+        }
+    }
+    bUseManifest = true;
+    SearchCache.Empty();
+    return true;
+}
+
 bool DefaultJSModuleLoader::Search(const FString& RequiredDir, const FString& RequiredModule, FString& Path, FString& AbsolutePath)
+{
+    FScopeLock ScopeLock(&CacheCritical);
+    const FString CacheKey = RequiredDir + TEXT("|") + RequiredModule;
+    if (const FSearchResult* Cached = SearchCache.Find(CacheKey))
+    {
+        Path = Cached->Path;
+        AbsolutePath = Cached->AbsolutePath;
+        return true;
+    }
+    if (SearchUncached(RequiredDir, RequiredModule, Path, AbsolutePath))
+    {
+        SearchCache.Add(CacheKey, FSearchResult{Path, AbsolutePath});
+        return true;
+    }
+    return false;
+}
+
+bool DefaultJSModuleLoader::SearchUncached(
+    const FString& RequiredDir, const FString& RequiredModule, FString& Path, FString& AbsolutePath)
 {
     if (SearchModuleInDir(RequiredDir, RequiredModule, Path, AbsolutePath))
     {
@@ -133,8 +212,14 @@ bool DefaultJSModuleLoader::Load(const FString& Path, TArray<uint8>& Content)
         const bool Success = FileHandle->Read(Content.GetData(), len);
         delete FileHandle;
 
+        if (!Success)
+        {
+            InvalidateSearchCache();
+        }
         return Success;
     }
+    // the file was found earlier and has been removed since, drop the cached hits
+    InvalidateSearchCache();
     return false;
 }
 
@@ -8,8 +8,14 @@
 
 #include "FunctionTranslator.h"
 #include "V8Utils.h"
+#include "ObjectMapper.h"
 #include "Misc/DefaultValueHelper.h"
 #include <mutex>
+#if PUERTS_UFUNCTION_FAST_CALL
+#pragma warning(push, 0)
+#include <v8-fast-api-calls.h>
+#pragma warning(pop)
+#endif
 
 static TMap<FName, TMap<FName, TMap<FName, FString>>> ParamDefaultMetas;
 
@@ -86,6 +92,311 @@ public:
 static GlobalBufferAutoRelease Dummy;
 #endif
 
+// keyed by path name rather than UFunction*, a reloaded class gets a new UFunction, maybe at a freed address
+struct FFastCallAllowList
+{
+    FCriticalSection Critical;
+    TSet<FName> FunctionPaths;
+};
+
+static FFastCallAllowList& GetFastCallAllowList()
+{
+    static FFastCallAllowList S_FastCallAllowList;
+    return S_FastCallAllowList;
+}
+
+void FFunctionTranslator::AllowFastCall(FName FunctionPath)
+{
+    FFastCallAllowList& AllowList = GetFastCallAllowList();
+    FScopeLock ScopeLock(&AllowList.Critical);
+    AllowList.FunctionPaths.Add(FunctionPath);
+}
+
+#if PUERTS_UFUNCTION_FAST_CALL
+static bool IsFastCallAllowed(UFunction* InFunction)
+{
+    // FNAME_Find, a path never opted in has no name to add
+    const FName FunctionPath(*InFunction->GetPathName(), FNAME_Find);
+    if (FunctionPath.IsNone())
+    {
+        return false;
+    }
+    FFastCallAllowList& AllowList = GetFastCallAllowList();
+    FScopeLock ScopeLock(&AllowList.Critical);
+    return AllowList.FunctionPaths.Contains(FunctionPath);
+}
+
+enum class EFastCallKind : uint8
+{
+    None,
+    Int32,
+    Double,
+    Bool,
+    Object
+};
+
+// a thunk is instantiated per signature, keep the combinations bounded
+static const int FastCallMaxArguments = 3;
+
+static EFastCallKind GetFastCallKind(PropertyMacro* Property)
+{
+    if (auto EnumProperty = CastFieldMacro<EnumPropertyMacro>(Property))
+    {
+        Property = EnumProperty->GetUnderlyingProperty();
+    }
+    if (Property->IsA<IntPropertyMacro>() || Property->IsA<Int16PropertyMacro>() || Property->IsA<Int8PropertyMacro>() ||
+        Property->IsA<BytePropertyMacro>() || Property->IsA<UInt16PropertyMacro>())
+    {
+        return EFastCallKind::Int32;
+    }
+    if (Property->IsA<FloatPropertyMacro>() || Property->IsA<DoublePropertyMacro>())
+    {
+        return EFastCallKind::Double;
+    }
+    if (Property->IsA<BoolPropertyMacro>())
+    {
+        return EFastCallKind::Bool;
+    }
+    if (Property->IsA<ObjectPropertyMacro>() && !Property->IsA<ClassPropertyMacro>())
+    {
+        return EFastCallKind::Object;
+    }
+    return EFastCallKind::None;
+}
+
+FORCEINLINE static NumericPropertyMacro* FastCallNumeric(PropertyMacro* Property)
+{
+    if (auto EnumProperty = CastFieldMacro<EnumPropertyMacro>(Property))
+    {
+        return EnumProperty->GetUnderlyingProperty();
+    }
+    return static_cast<NumericPropertyMacro*>(Property);
+}
+
+FORCEINLINE static bool FastCallStore(PropertyMacro* Property, void* Params, int32_t Value)
+{
+    FastCallNumeric(Property)->SetIntPropertyValue(Property->ContainerPtrToValuePtr<void>(Params), static_cast<int64>(Value));
+    return true;
+}
+
+FORCEINLINE static bool FastCallStore(PropertyMacro* Property, void* Params, double Value)
+{
+    FastCallNumeric(Property)->SetFloatingPointPropertyValue(Property->ContainerPtrToValuePtr<void>(Params), Value);
+    return true;
+}
+
+FORCEINLINE static bool FastCallStore(PropertyMacro* Property, void* Params, bool Value)
+{
+    static_cast<BoolPropertyMacro*>(Property)->SetPropertyValue(Property->ContainerPtrToValuePtr<void>(Params), Value);
+    return true;
+}
+
+FORCEINLINE static bool FastCallStore(PropertyMacro* Property, void* Params, v8::Local<v8::Value> Value)
+{
+    UObject* Object = nullptr;
+    if (Value->IsObject())
+    {
+        Object = FV8Utils::GetUObject(Value.As<v8::Object>());
+        auto ObjectProperty = static_cast<ObjectPropertyMacro*>(Property);
+        if (!Object || Object == RELEASED_UOBJECT || FV8Utils::IsReleasedPtr(Object) || !Object->IsA(ObjectProperty->PropertyClass))
+        {
+            return false;
+        }
+    }
+    else if (!Value->IsNullOrUndefined())
+    {
+        return false;
+    }
+    static_cast<ObjectPropertyMacro*>(Property)->SetObjectPropertyValue(Property->ContainerPtrToValuePtr<void>(Params), Object);
+    return true;
+}
+
+template <typename Ret>
+struct FFastCallReturn
+{
+};
+
+template <>
+struct FFastCallReturn<void>
+{
+    FORCEINLINE static void Get(FPropertyTranslator* Return, void* Params)
+    {
+    }
+};
+
+template <>
+struct FFastCallReturn<int32_t>
+{
+    FORCEINLINE static int32_t Get(FPropertyTranslator* Return, void* Params)
+    {
+        return static_cast<int32_t>(
+            FastCallNumeric(Return->Property)->GetSignedIntPropertyValue(Return->Property->ContainerPtrToValuePtr<void>(Params)));
+    }
+};
+
+template <>
+struct FFastCallReturn<double>
+{
+    FORCEINLINE static double Get(FPropertyTranslator* Return, void* Params)
+    {
+        return FastCallNumeric(Return->Property)
+            ->GetFloatingPointPropertyValue(Return->Property->ContainerPtrToValuePtr<void>(Params));
+    }
+};
+
+template <>
+struct FFastCallReturn<bool>
+{
+    FORCEINLINE static bool Get(FPropertyTranslator* Return, void* Params)
+    {
+        return static_cast<BoolPropertyMacro*>(Return->Property)
+            ->GetPropertyValue(Return->Property->ContainerPtrToValuePtr<void>(Params));
+    }
+};
+
+template <typename Ret, typename... Args>
+struct FUFunctionFastCall
+{
+    static Ret Call(v8::Local<v8::Object> Receiver, Args... InArgs, v8::FastApiCallbackOptions& Options)
+    {
+        FFunctionTranslator* Translator = static_cast<FFunctionTranslator*>(v8::Local<v8::External>::Cast(Options.data)->Value());
+        UFunction* CallFunction = Translator->Function.Get();
+        UObject* CallObject = Translator->IsStatic ? Translator->BindObject.Get() : FV8Utils::GetUObject(Receiver);
+        // the slow path does the lazy init of static functions and throws for invalid objects,
+        // a translator re-inited with another signature also goes there
+        if (UNLIKELY(!CallFunction || !CallObject || CallObject == RELEASED_UOBJECT || FV8Utils::IsReleasedPtr(CallObject) ||
+                     Translator->FastCallInfo != Info()))
+        {
+            Options.fallback = true;
+            return Ret();
+        }
+
+#if defined(USE_GLOBAL_PARAMS_BUFFER)
+        void* Params = Buffer;
+#else
+        void* Params = Translator->ParamsBufferSize > 0 ? FMemory_Alloca(Translator->ParamsBufferSize) : nullptr;
+#endif
+        if (Params)
+        {
+            FMemory::Memzero(Params, Translator->ParamsBufferSize);
+        }
+
+        int Index = 0;
+        bool Converted = true;
+        int Dummy[] = {0, (Converted = FastCallStore(Translator->Arguments[Index++]->Property, Params, InArgs) && Converted, 0)...};
+        (void) Dummy;
+        (void) Index;
+        if (!Converted)
+        {
+            Options.fallback = true;
+            return Ret();
+        }
+
+        FFrame NewStack(CallObject, CallFunction, Params, nullptr,
+#if ENGINE_MINOR_VERSION >= 25 || ENGINE_MAJOR_VERSION > 4
+            CallFunction->ChildProperties
+#else
+            CallFunction->Children
+#endif
+        );
+        const bool bHasReturnParam = CallFunction->ReturnValueOffset != MAX_uint16;
+        uint8* ReturnValueAddress = bHasReturnParam ? ((uint8*) Params + CallFunction->ReturnValueOffset) : nullptr;
+        CallFunction->Invoke(CallObject, NewStack, ReturnValueAddress);
+
+        return FFastCallReturn<Ret>::Get(Translator->Return.get(), Params);
+    }
+
+    static const v8::CFunction* Info()
+    {
+        static v8::CFunction CInfo = v8::CFunction::Make(Call);
+        return &CInfo;
+    }
+};
+
+template <typename Ret, typename... Args>
+struct FFastCallSelector
+{
+    static const v8::CFunction* Select(const EFastCallKind* Kinds, int Remain)
+    {
+        return Remain == 0 ? FUFunctionFastCall<Ret, Args...>::Info()
+                           : Next(Kinds, Remain, std::integral_constant<bool, (sizeof...(Args) < FastCallMaxArguments)>());
+    }
+
+    static const v8::CFunction* Next(const EFastCallKind* Kinds, int Remain, std::false_type)
+    {
+        return nullptr;
+    }
+
+    static const v8::CFunction* Next(const EFastCallKind* Kinds, int Remain, std::true_type)
+    {
+        switch (Kinds[0])
+        {
+            case EFastCallKind::Int32:
+                return FFastCallSelector<Ret, Args..., int32_t>::Select(Kinds + 1, Remain - 1);
+            case EFastCallKind::Double:
+                return FFastCallSelector<Ret, Args..., double>::Select(Kinds + 1, Remain - 1);
+            case EFastCallKind::Bool:
+                return FFastCallSelector<Ret, Args..., bool>::Select(Kinds + 1, Remain - 1);
+            case EFastCallKind::Object:
+                return FFastCallSelector<Ret, Args..., v8::Local<v8::Value>>::Select(Kinds + 1, Remain - 1);
+            default:
+                return nullptr;
+        }
+    }
+};
+
+void FFunctionTranslator::InitFastCall()
+{
+    FastCallInfo = nullptr;
+
+    UFunction* InFunction = Function.Get();
+    // CallFunction->Invoke must be the whole call, nothing may run js or touch the v8 heap. Only the function's author
+    // can promise that, so the signature alone is not enough, it has to be opted in
+    if (!InFunction || IsInterfaceFunction || ArgumentDefaultValues || !InFunction->HasAnyFunctionFlags(FUNC_Native) ||
+        InFunction->HasAnyFunctionFlags(FUNC_Net | FUNC_UbergraphFunction) || Arguments.size() > FastCallMaxArguments ||
+        !IsFastCallAllowed(InFunction))
+    {
+        return;
+    }
+
+    EFastCallKind Kinds[FastCallMaxArguments];
+    for (int i = 0; i < Arguments.size(); ++i)
+    {
+        if (!Arguments[i] || Arguments[i]->Property->HasAnyPropertyFlags(CPF_OutParm))
+        {
+            return;
+        }
+        Kinds[i] = GetFastCallKind(Arguments[i]->Property);
+        if (Kinds[i] == EFastCallKind::None)
+        {
+            return;
+        }
+    }
+
+    switch (Return ? GetFastCallKind(Return->Property) : EFastCallKind::None)
+    {
+        case EFastCallKind::None:
+            if (!Return)
+            {
+                FastCallInfo = FFastCallSelector<void>::Select(Kinds, Arguments.size());
+            }
+            break;
+        case EFastCallKind::Int32:
+            FastCallInfo = FFastCallSelector<int32_t>::Select(Kinds, Arguments.size());
+            break;
+        case EFastCallKind::Double:
+            FastCallInfo = FFastCallSelector<double>::Select(Kinds, Arguments.size());
+            break;
+        case EFastCallKind::Bool:
+            FastCallInfo = FFastCallSelector<bool>::Select(Kinds, Arguments.size());
+            break;
+        default:
+            // returning a UObject needs a js wrapper, which is an allocation
+            break;
+    }
+}
+#endif
+
 FFunctionTranslator::FFunctionTranslator(UFunction* InFunction, bool IsDelegate)
 {
     Init(InFunction, IsDelegate);
@@ -209,10 +520,148 @@ void FFunctionTranslator::Init(UFunction* InFunction, bool IsDelegate)
             }
         }
     }
+
+    InitCallJsPlan();
+
+#if PUERTS_UFUNCTION_FAST_CALL
+    if (!IsDelegate)
+    {
+        InitFastCall();
+    }
+#endif
+}
+
+static ECallJsParamKind GetCallJsParamKind(PropertyMacro* Property)
+{
+    if (Property->ArrayDim != 1)
+    {
+        return ECallJsParamKind::Generic;
+    }
+    if (Property->IsA<IntPropertyMacro>())
+    {
+        return ECallJsParamKind::Int32;
+    }
+    if (Property->IsA<FloatPropertyMacro>())
+    {
+        return ECallJsParamKind::Float;
+    }
+    if (Property->IsA<DoublePropertyMacro>())
+    {
+        return ECallJsParamKind::Double;
+    }
+    if (Property->IsA<BoolPropertyMacro>())
+    {
+        return ECallJsParamKind::Bool;
+    }
+    if (Property->IsA<BytePropertyMacro>())
+    {
+        return ECallJsParamKind::UInt8;
+    }
+    if (Property->IsA<Int8PropertyMacro>())
+    {
+        return ECallJsParamKind::Int8;
+    }
+    if (Property->IsA<Int16PropertyMacro>())
+    {
+        return ECallJsParamKind::Int16;
+    }
+    if (Property->IsA<UInt16PropertyMacro>())
+    {
+        return ECallJsParamKind::UInt16;
+    }
+    if (Property->IsA<NamePropertyMacro>())
+    {
+        return ECallJsParamKind::Name;
+    }
+    if (Property->IsA<StrPropertyMacro>())
+    {
+        return ECallJsParamKind::String;
+    }
+    if (Property->IsA<ObjectPropertyMacro>() && !Property->IsA<ClassPropertyMacro>())
+    {
+        return ECallJsParamKind::Object;
+    }
+    return ECallJsParamKind::Generic;
+}
+
+void FFunctionTranslator::InitCallJsPlan()
+{
+    CallJsPlan.clear();
+    int32 ArgumentIndex = 0;
+    for (TFieldIterator<PropertyMacro> It(Function.Get()); It && (It->PropertyFlags & CPF_Parm); ++It)
+    {
+        PropertyMacro* Property = *It;
+        FCallJsParamPlan Plan;
+        Plan.Property = Property;
+        Plan.Offset = Property->GetOffset_ForUFunction();
+        Plan.NeedInitialize = !Property->HasAnyPropertyFlags(CPF_ZeroConstructor);
+        Plan.IsOutParm = Property->HasAnyPropertyFlags(CPF_OutParm);
+        if (Property->HasAnyPropertyFlags(CPF_ReturnParm))
+        {
+            Plan.ArgumentIndex = -1;
+            Plan.Kind = ECallJsParamKind::Generic;
+            Plan.WriteBack = false;
+        }
+        else
+        {
+            Plan.ArgumentIndex = ArgumentIndex;
+            Plan.WriteBack = Arguments[ArgumentIndex]->IsOut();
+            // out params are passed as a $ref, only the translator knows how
+            Plan.Kind = Plan.WriteBack ? ECallJsParamKind::Generic : GetCallJsParamKind(Property);
+            ++ArgumentIndex;
+        }
+        CallJsPlan.push_back(Plan);
+    }
+}
+
+FORCEINLINE static v8::Local<v8::Value> CallJsParamToJs(v8::Isolate* Isolate, v8::Local<v8::Context>& Context,
+    ECallJsParamKind Kind, PropertyMacro* Property, FPropertyTranslator* Translator, const void* ValuePtr)
+{
+    switch (Kind)
+    {
+        case ECallJsParamKind::Int8:
+            return v8::Integer::New(Isolate, *static_cast<const int8*>(ValuePtr));
+        case ECallJsParamKind::Int16:
+            return v8::Integer::New(Isolate, *static_cast<const int16*>(ValuePtr));
+        case ECallJsParamKind::Int32:
+            return v8::Integer::New(Isolate, *static_cast<const int32*>(ValuePtr));
+        case ECallJsParamKind::UInt8:
+            return v8::Integer::New(Isolate, *static_cast<const uint8*>(ValuePtr));
+        case ECallJsParamKind::UInt16:
+            return v8::Integer::New(Isolate, *static_cast<const uint16*>(ValuePtr));
+        case ECallJsParamKind::Float:
+            return v8::Number::New(Isolate, *static_cast<const float*>(ValuePtr));
+        case ECallJsParamKind::Double:
+            return v8::Number::New(Isolate, *static_cast<const double*>(ValuePtr));
+        case ECallJsParamKind::Bool:
+            return v8::Boolean::New(Isolate, static_cast<BoolPropertyMacro*>(Property)->GetPropertyValue(ValuePtr));
+        case ECallJsParamKind::Name:
+            return FV8Utils::IsolateData<IObjectMapper>(Isolate)->NameToString(Isolate, *static_cast<const FName*>(ValuePtr));
+        case ECallJsParamKind::String:
+            return FV8Utils::ToV8String(Isolate, *static_cast<const FString*>(ValuePtr));
+        case ECallJsParamKind::Object:
+        {
+            UObject* UEObject = ObjectPropertyMacro::GetPropertyValue(ValuePtr);
+            if (!UEObject || !UEObject->IsValidLowLevelFast() || UEObjectIsPendingKill(UEObject))
+            {
+                return v8::Undefined(Isolate);
+            }
+            return FV8Utils::IsolateData<IObjectMapper>(Isolate)->FindOrAdd(Isolate, Context, UEObject->GetClass(), UEObject);
+        }
+        default:
+            return Translator->UEToJs(Isolate, Context, ValuePtr, false);
+    }
 }
 
 v8::Local<v8::FunctionTemplate> FFunctionTranslator::ToFunctionTemplate(v8::Isolate* Isolate)
 {
+#if PUERTS_UFUNCTION_FAST_CALL
+    if (FastCallInfo)
+    {
+        return v8::FunctionTemplate::New(Isolate, Call, v8::External::New(Isolate, this), v8::Local<v8::Signature>(), 0,
+            v8::ConstructorBehavior::kThrow, v8::SideEffectType::kHasSideEffect, FastCallInfo);
+    }
+#endif
     return v8::FunctionTemplate::New(Isolate, Call, v8::External::New(Isolate, this));
 }
 
@@ -490,10 +939,14 @@ void FFunctionTranslator::CallJs(v8::Isolate* Isolate, v8::Local<v8::Context>& C
 {
     void* Params = Stack.Locals;
 
-    FOutParmRec* NewOutParms = nullptr;
-
     const bool CallByBP = Stack.Node != Stack.CurrentNativeFunction;
 
+    const int32 ArgumentCount = static_cast<int32>(Arguments.size());
+
+    // caller side address of each out param, nullptr if there is nowhere to write back
+    void** OutAddrs = static_cast<void**>(FMemory_Alloca(sizeof(void*) * (ArgumentCount + 1)));
+    FMemory::Memzero(OutAddrs, sizeof(void*) * (ArgumentCount + 1));
+
     if (CallByBP)
     {
 #if defined(USE_GLOBAL_PARAMS_BUFFER)
@@ -505,55 +958,30 @@ void FFunctionTranslator::CallJs(v8::Isolate* Isolate, v8::Local<v8::Context>& C
         if (Params)
         {
             FMemory::Memzero(Params, ParamsBufferSize);
-            FOutParmRec** LastOut = &NewOutParms;
 
             // ScriptCore.cpp
-            for (PropertyMacro* Property = (PropertyMacro*) (
-#if ENGINE_MINOR_VERSION >= 25 || ENGINE_MAJOR_VERSION > 4
-                     Function->ChildProperties
-#else
-                     Function->Children
-#endif
-                 );
-                 *Stack.Code != EX_EndFunctionParms; Property = (PropertyMacro*) (Property->Next))
+            for (const FCallJsParamPlan& Plan : CallJsPlan)
             {
-                checkfSlow(Property, TEXT("NULL Property in Function %s"), *Function->GetPathName());
-
-                Property->InitializeValue_InContainer(Params);
-
-                if ((Property->PropertyFlags & CPF_ReturnParm) != 0)
+                if (*Stack.Code == EX_EndFunctionParms)
                 {
-                    continue;
+                    break;
                 }
-                Stack.MostRecentPropertyAddress = nullptr;
-
-                if (Property->PropertyFlags & CPF_OutParm)
+                uint8* ValuePtr = static_cast<uint8*>(Params) + Plan.Offset;
+                if (Plan.NeedInitialize)
                 {
-                    Stack.Step(Stack.Object, Property->ContainerPtrToValuePtr<uint8>(Params));
-
-                    if (LastOut)
-                    {
-                        CA_SUPPRESS(6263)
-                        FOutParmRec* Out = (FOutParmRec*) FMemory_Alloca(sizeof(FOutParmRec));
-                        ensure(Stack.MostRecentPropertyAddress);
-                        Out->PropAddr = (Stack.MostRecentPropertyAddress != NULL) ? Stack.MostRecentPropertyAddress
-                                                                                  : Property->ContainerPtrToValuePtr<uint8>(Params);
-                        Out->Property = Property;
-
-                        if (*LastOut)
-                        {
-                            (*LastOut)->NextOutParm = Out;
-                            LastOut = &(*LastOut)->NextOutParm;
-                        }
-                        else
-                        {
-                            *LastOut = Out;
-                        }
-                    }
+                    Plan.Property->InitializeValue(ValuePtr);
                 }
-                else
+                if (Plan.ArgumentIndex < 0)
                 {
-                    Stack.Step(Stack.Object, Property->ContainerPtrToValuePtr<uint8>(Params));
+                    continue;
+                }
+                Stack.MostRecentPropertyAddress = nullptr;
+                Stack.Step(Stack.Object, ValuePtr);
+                if (Plan.IsOutParm)
+                {
+                    ensure(Stack.MostRecentPropertyAddress);
+                    OutAddrs[Plan.ArgumentIndex] =
+                        Stack.MostRecentPropertyAddress != NULL ? Stack.MostRecentPropertyAddress : ValuePtr;
                 }
             }
         }
@@ -563,36 +991,41 @@ void FFunctionTranslator::CallJs(v8::Isolate* Isolate, v8::Local<v8::Context>& C
             Stack.SkipCode(1);    // skip EX_EndFunctionParms
         }
     }
-
-    v8::Local<v8::Value>* Args =
-        static_cast<v8::Local<v8::Value>*>(FMemory_Alloca(sizeof(v8::Local<v8::Value>) * Arguments.size()));
-    FMemory::Memset(Args, 0, sizeof(v8::Local<v8::Value>) * Arguments.size());
-    for (int i = 0; i < Arguments.size(); ++i)
+    else if (Stack.OutParms)    // may be fast call
     {
-        const auto Property = Arguments[i]->Property;
-        if (!CallByBP && (Property->PropertyFlags & CPF_OutParm) && Stack.OutParms)    // may be fast call
+        for (const FCallJsParamPlan& Plan : CallJsPlan)
         {
-            FOutParmRec* Out = Stack.OutParms;
-
-            while (Out->Property != Property)
+            if (Plan.IsOutParm && Plan.ArgumentIndex >= 0)
             {
-                Out = Out->NextOutParm;
+                FOutParmRec* Out = GetMatchOutParmRec(Stack.OutParms, Plan.Property);
                 checkSlow(Out);
+                OutAddrs[Plan.ArgumentIndex] = Out ? Out->PropAddr : nullptr;
             }
-            Args[i] = Arguments[i]->UEToJs(Isolate, Context, Out->PropAddr, false);
+        }
+    }
+
+    v8::Local<v8::Value>* Args = static_cast<v8::Local<v8::Value>*>(FMemory_Alloca(sizeof(v8::Local<v8::Value>) * ArgumentCount));
+    FMemory::Memset(Args, 0, sizeof(v8::Local<v8::Value>) * ArgumentCount);
+    for (const FCallJsParamPlan& Plan : CallJsPlan)
+    {
+        if (Plan.ArgumentIndex < 0)
+        {
             continue;
         }
-        Args[i] = Arguments[i]->UEToJsInContainer(Isolate, Context, Params, false);
+        const void* ValuePtr = (!CallByBP && OutAddrs[Plan.ArgumentIndex]) ? OutAddrs[Plan.ArgumentIndex]
+                                                                           : static_cast<uint8*>(Params) + Plan.Offset;
+        Args[Plan.ArgumentIndex] =
+            CallJsParamToJs(Isolate, Context, Plan.Kind, Plan.Property, Arguments[Plan.ArgumentIndex].get(), ValuePtr);
     }
 
     v8::MaybeLocal<v8::Value> Result;
     if (UNLIKELY(SkipWorldContextInArg0))
     {
-        Result = JsFunction->Call(Context, This, Arguments.size() - 1, &Args[0] + 1);
+        Result = JsFunction->Call(Context, This, ArgumentCount - 1, &Args[0] + 1);
     }
     else
     {
-        Result = JsFunction->Call(Context, This, Arguments.size(), Args);
+        Result = JsFunction->Call(Context, This, ArgumentCount, Args);
     }
 
     if (!Result.IsEmpty())    // empty mean exception
@@ -602,17 +1035,12 @@ void FFunctionTranslator::CallJs(v8::Isolate* Isolate, v8::Local<v8::Context>& C
             Return->JsToUE(Isolate, Context, Result.ToLocalChecked(), RESULT_PARAM, true);
         }
 
-        auto OutParms = NewOutParms ? NewOutParms : Stack.OutParms;
-
-        for (int i = 0; i < Arguments.size(); ++i)
+        for (const FCallJsParamPlan& Plan : CallJsPlan)
         {
-            if (Arguments[i]->IsOut())
+            if (Plan.WriteBack && OutAddrs[Plan.ArgumentIndex])
             {
-                auto OutParmRec = GetMatchOutParmRec(OutParms, Arguments[i]->Property);
-                if (OutParmRec)
-                {
-                    Arguments[i]->JsToUEOut(Isolate, Context, Args[i], OutParmRec->PropAddr, true);
-                }
+                Arguments[Plan.ArgumentIndex]->JsToUEOut(
+                    Isolate, Context, Args[Plan.ArgumentIndex], OutAddrs[Plan.ArgumentIndex], true);
             }
         }
     }
@@ -25,8 +25,37 @@ PRAGMA_DISABLE_UNDEFINED_IDENTIFIER_WARNINGS
 #pragma warning(pop)
 PRAGMA_ENABLE_UNDEFINED_IDENTIFIER_WARNINGS
 
+// FastApiCallbackOptions::data is a Local<Value> since v8 10
+#if defined(WITH_V8_FAST_CALL) && !defined(WITH_QUICKJS) && V8_MAJOR_VERSION >= 10
+#define PUERTS_UFUNCTION_FAST_CALL 1
+#else
+#define PUERTS_UFUNCTION_FAST_CALL 0
+#endif
+
 namespace PUERTS_NAMESPACE
 {
+#if PUERTS_UFUNCTION_FAST_CALL
+template <typename Ret, typename... Args>
+struct FUFunctionFastCall;
+#endif
+
+// how CallJs hands one parameter of a blueprint call to js, everything but Generic skips the FPropertyTranslator
+enum class ECallJsParamKind : uint8
+{
+    Generic,
+    Int8,
+    Int16,
+    Int32,
+    UInt8,
+    UInt16,
+    Float,
+    Double,
+    Bool,
+    Name,
+    String,
+    Object
+};
+
 class FFunctionTranslator
 {
 public:
@@ -53,6 +82,9 @@ public:
 
     bool IsValid() const;
 
+    // see FJsEnv::AllowUFunctionFastCall
+    static void AllowFastCall(FName FunctionPath);
+
 protected:
     FORCEINLINE bool Call_ProcessParams(v8::Isolate* Isolate, v8::Local<v8::Context>& Context,
         const v8::FunctionCallbackInfo<v8::Value>& Info, void* Params, int StartPos)
@@ -114,9 +146,34 @@ protected:
     uint32 ParamsBufferSize;
 
     void* ArgumentDefaultValues;
+
+    struct FCallJsParamPlan
+    {
+        PropertyMacro* Property;
+        int32 Offset;
+        int32 ArgumentIndex;    // -1 for the return value
+        ECallJsParamKind Kind;
+        bool NeedInitialize;    // the params buffer is zeroed, zero constructed types need nothing more
+        bool IsOutParm;
+        bool WriteBack;    // a non const out param, copied back to the caller after the js call
+    };
+
+    // every parameter in declaration order, return value included, built once so CallJs does a flat loop
+    std::vector<FCallJsParamPlan> CallJsPlan;
+
+    void InitCallJsPlan();
 #if WITH_EDITOR
     FName FunctionName;
 #endif
+#if PUERTS_UFUNCTION_FAST_CALL
+    // shared by all native UFunctions with the same numeric/bool/enum/UObject* signature, null if not eligible
+    const v8::CFunction* FastCallInfo = nullptr;
+
+    void InitFastCall();
+
+    template <typename Ret, typename... Args>
+    friend struct FUFunctionFastCall;
+#endif
 private:
     static void Call(const v8::FunctionCallbackInfo<v8::Value>& Info);
 
@@ -12,6 +12,11 @@
 #endif
 #include <map>
 #include <cstring>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace PUERTS_NAMESPACE
 {
@@ -62,6 +67,100 @@ void JSClassDefinitionDelete(JSClassDefinition* ClassDefinition)
     delete ClassDefinition;
 }
 
+// TypeId -> JSClassDefinition, probed without any lock. Slots are only ever filled, never cleared, and the
+// value of a slot is written before its key is published, so a reader sees either nothing or a complete entry.
+// Capacity is a power of two and the load factor stays under 1/2, a probe always ends at an empty slot.
+class ClassIdTable
+{
+public:
+    explicit ClassIdTable(size_t InCapacity) : Capacity(InCapacity), Slots(new Slot[InCapacity]())
+    {
+    }
+
+    JSClassDefinition* Find(const void* TypeId) const
+    {
+        for (size_t i = Hash(TypeId) & (Capacity - 1);; i = (i + 1) & (Capacity - 1))
+        {
+            const void* Key = Slots[i].TypeId.load(std::memory_order_acquire);
+            if (Key == TypeId)
+            {
+                return Slots[i].ClassDefinition.load(std::memory_order_acquire);
+            }
+            if (!Key)
+            {
+                return nullptr;
+            }
+        }
+    }
+
+    // writer only, returns the definition that was replaced if any
+    JSClassDefinition* Set(const void* TypeId, JSClassDefinition* ClassDefinition)
+    {
+        for (size_t i = Hash(TypeId) & (Capacity - 1);; i = (i + 1) & (Capacity - 1))
+        {
+            const void* Key = Slots[i].TypeId.load(std::memory_order_relaxed);
+            if (Key == TypeId)
+            {
+                return Slots[i].ClassDefinition.exchange(ClassDefinition, std::memory_order_acq_rel);
+            }
+            if (!Key)
+            {
+                Slots[i].ClassDefinition.store(ClassDefinition, std::memory_order_relaxed);
+                Slots[i].TypeId.store(TypeId, std::memory_order_release);
+                ++Count;
+                return nullptr;
+            }
+        }
+    }
+
+    bool IsFullFor(size_t Adding) const
+    {
+        return (Count + Adding) * 2 > Capacity;
+    }
+
+    template <typename Func>
+    void Foreach(Func&& Callback) const
+    {
+        for (size_t i = 0; i < Capacity; ++i)
+        {
+            if (Slots[i].TypeId.load(std::memory_order_relaxed))
+            {
+                Callback(Slots[i].TypeId.load(std::memory_order_relaxed), Slots[i].ClassDefinition.load(std::memory_order_relaxed));
+            }
+        }
+    }
+
+    size_t GetCapacity() const
+    {
+        return Capacity;
+    }
+
+private:
+    struct Slot
+    {
+        std::atomic<const void*> TypeId;
+        std::atomic<JSClassDefinition*> ClassDefinition;
+    };
+
+    static size_t Hash(const void* TypeId)
+    {
+        // TypeIds are addresses, the low bits are mostly alignment
+        uint64_t Key = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(TypeId));
+        Key ^= Key >> 33;
+        Key *= 0xff51afd7ed558ccdull;
+        Key ^= Key >> 33;
+        return static_cast<size_t>(Key);
+    }
+
+    size_t Capacity;
+    size_t Count = 0;
+    std::unique_ptr<Slot[]> Slots;
+};
+
+// Isolates on different threads may look classes up concurrently. FindClassByID never takes a lock: it reads
+// the current ClassIdTable through an atomic pointer. Registrations are rare, they are serialized by Mutex, a
+// full table is replaced by a copy twice as large. Nothing a reader may still hold is freed before the register
+// goes away: old tables are kept (they add up to less than the current one) and so are re-registered definitions.
 class JSClassRegister
 {
 public:
@@ -111,7 +210,12 @@ public:
 #endif
 
 private:
-    std::map<const void*, JSClassDefinition*> CDataIdToClassDefinition;
+    void SetClassDefinition(const void* TypeId, JSClassDefinition* ClassDefinition);
+
+    std::atomic<ClassIdTable*> CDataIdToClassDefinition;
+    std::vector<std::unique_ptr<ClassIdTable>> ClassIdTables;
+    std::vector<JSClassDefinition*> ReplacedClassDefinitions;
+    std::mutex Mutex;
     std::map<PString, JSClassDefinition*> CDataNameToClassDefinition;
     pesapi_class_not_found_callback ClassNotFoundCallback = nullptr;
 #if USING_IN_UNREAL_ENGINE
@@ -122,15 +226,21 @@ private:
 
 JSClassRegister::JSClassRegister()
 {
+    ClassIdTables.emplace_back(new ClassIdTable(256));
+    CDataIdToClassDefinition.store(ClassIdTables.back().get(), std::memory_order_release);
 }
 
 JSClassRegister::~JSClassRegister()
 {
-    for (auto& KV : CDataIdToClassDefinition)
+    CDataIdToClassDefinition.load(std::memory_order_relaxed)
+        ->Foreach([](const void*, JSClassDefinition* ClassDefinition) { JSClassDefinitionDelete(ClassDefinition); });
+    for (auto ClassDefinition : ReplacedClassDefinitions)
     {
-        JSClassDefinitionDelete(KV.second);
+        JSClassDefinitionDelete(ClassDefinition);
     }
-    CDataIdToClassDefinition.clear();
+    ReplacedClassDefinitions.clear();
+    CDataIdToClassDefinition.store(nullptr, std::memory_order_relaxed);
+    ClassIdTables.clear();
 #if USING_IN_UNREAL_ENGINE
     for (auto& KV : StructNameToClassDefinition)
     {
@@ -140,19 +250,34 @@ JSClassRegister::~JSClassRegister()
 #endif
 }
 
+void JSClassRegister::SetClassDefinition(const void* TypeId, JSClassDefinition* ClassDefinition)
+{
+    ClassIdTable* Table = CDataIdToClassDefinition.load(std::memory_order_relaxed);
+    if (Table->IsFullFor(1))
+    {
+        ClassIdTable* Bigger = new ClassIdTable(Table->GetCapacity() * 2);
+        Table->Foreach([Bigger](const void* Key, JSClassDefinition* Value) { Bigger->Set(Key, Value); });
+        ClassIdTables.emplace_back(Bigger);
+        CDataIdToClassDefinition.store(Bigger, std::memory_order_release);
+        Table = Bigger;
+    }
+    if (auto Replaced = Table->Set(TypeId, ClassDefinition))
+    {
+        // another thread may be using it right now
+        ReplacedClassDefinitions.push_back(Replaced);
+    }
+}
+
 void JSClassRegister::RegisterClass(const JSClassDefinition& ClassDefinition)
 {
+    std::lock_guard<std::mutex> Guard(Mutex);
     if (ClassDefinition.TypeId && ClassDefinition.ScriptName)
     {
-        auto cd_iter = CDataIdToClassDefinition.find(ClassDefinition.TypeId);
-        if (cd_iter != CDataIdToClassDefinition.end())
-        {
-            JSClassDefinitionDelete(cd_iter->second);
-        }
-        CDataIdToClassDefinition[ClassDefinition.TypeId] = JSClassDefinitionDuplicate(&ClassDefinition);
+        auto Duplicated = JSClassDefinitionDuplicate(&ClassDefinition);
         PString SN = ClassDefinition.ScriptName;
-        CDataNameToClassDefinition[SN] = CDataIdToClassDefinition[ClassDefinition.TypeId];
-        CDataIdToClassDefinition[ClassDefinition.TypeId]->ScriptName = CDataNameToClassDefinition.find(SN)->first.c_str();
+        CDataNameToClassDefinition[SN] = Duplicated;
+        Duplicated->ScriptName = CDataNameToClassDefinition.find(SN)->first.c_str();
+        SetClassDefinition(ClassDefinition.TypeId, Duplicated);
     }
 #if USING_IN_UNREAL_ENGINE
     else if (ClassDefinition.UETypeName)
@@ -161,7 +286,7 @@ void JSClassRegister::RegisterClass(const JSClassDefinition& ClassDefinition)
         auto ud_iter = StructNameToClassDefinition.find(SN);
         if (ud_iter != StructNameToClassDefinition.end())
         {
-            JSClassDefinitionDelete(ud_iter->second);
+            ReplacedClassDefinitions.push_back(ud_iter->second);
         }
         StructNameToClassDefinition[SN] = JSClassDefinitionDuplicate(&ClassDefinition);
     }
@@ -202,6 +327,7 @@ void JSClassRegister::SetClassTypeInfo(const void* TypeId, const NamedFunctionIn
     const NamedFunctionInfo* MethodInfos, const NamedFunctionInfo* FunctionInfos, const NamedPropertyInfo* PropertyInfos,
     const NamedPropertyInfo* VariableInfos)
 {
+    std::lock_guard<std::mutex> Guard(Mutex);
     auto ClassDef = const_cast<JSClassDefinition*>(FindClassByID(TypeId));
     if (ClassDef)
     {
@@ -221,19 +347,12 @@ const JSClassDefinition* JSClassRegister::FindClassByID(const void* TypeId)
     {
         return nullptr;
     }
-    auto Iter = CDataIdToClassDefinition.find(TypeId);
-    if (Iter == CDataIdToClassDefinition.end())
-    {
-        return nullptr;
-    }
-    else
-    {
-        return Iter->second;
-    }
+    return CDataIdToClassDefinition.load(std::memory_order_acquire)->Find(TypeId);
 }
 
 const JSClassDefinition* JSClassRegister::FindCppTypeClassByName(const PString& Name)
 {
+    std::lock_guard<std::mutex> Guard(Mutex);
     auto Iter = CDataNameToClassDefinition.find(Name);
     if (Iter == CDataNameToClassDefinition.end())
     {
@@ -248,11 +367,13 @@ const JSClassDefinition* JSClassRegister::FindCppTypeClassByName(const PString&
 #if USING_IN_UNREAL_ENGINE
 void JSClassRegister::RegisterAddon(const PString& Name, AddonRegisterFunc RegisterFunc)
 {
+    std::lock_guard<std::mutex> Guard(Mutex);
     AddonRegisterInfos[Name] = RegisterFunc;
 }
 
 AddonRegisterFunc JSClassRegister::FindAddonRegisterFunc(const PString& Name)
 {
+    std::lock_guard<std::mutex> Guard(Mutex);
     auto Iter = AddonRegisterInfos.find(Name);
     if (Iter == AddonRegisterInfos.end())
     {
@@ -266,6 +387,7 @@ AddonRegisterFunc JSClassRegister::FindAddonRegisterFunc(const PString& Name)
 
 const JSClassDefinition* JSClassRegister::FindClassByType(UStruct* Type)
 {
+    std::lock_guard<std::mutex> Guard(Mutex);
     auto Iter = StructNameToClassDefinition.find(Type->GetName());
     if (Iter == StructNameToClassDefinition.end())
     {
@@ -280,16 +402,25 @@ const JSClassDefinition* JSClassRegister::FindClassByType(UStruct* Type)
 
 void JSClassRegister::ForeachRegisterClass(std::function<void(const JSClassDefinition* ClassDefinition)> Callback)
 {
-    for (auto& KV : CDataNameToClassDefinition)
+    // the callback runs unlocked, it may well look up or register classes
+    std::vector<const JSClassDefinition*> ClassDefinitions;
     {
-        Callback(KV.second);
-    }
+        std::lock_guard<std::mutex> Guard(Mutex);
+        for (auto& KV : CDataNameToClassDefinition)
+        {
+            ClassDefinitions.push_back(KV.second);
+        }
 #if USING_IN_UNREAL_ENGINE
-    for (auto& KV : StructNameToClassDefinition)
+        for (auto& KV : StructNameToClassDefinition)
+        {
+            ClassDefinitions.push_back(KV.second);
+        }
+#endif
+    }
+    for (auto ClassDefinition : ClassDefinitions)
     {
-        Callback(KV.second);
+        Callback(ClassDefinition);
     }
-#endif
 }
 
 JSClassRegister* GetJSClassRegister()
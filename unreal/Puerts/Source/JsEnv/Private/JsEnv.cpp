@@ -64,6 +64,11 @@ void FJsEnv::RebindJs()
 {
     GameScript->RebindJs();
 }
+
+void FJsEnv::AllowUFunctionFastCall(FName FunctionPath)
+{
+    FFunctionTranslator::AllowFastCall(FunctionPath);
+}
 #endif
 
 FString FJsEnv::CurrentStackTrace()
@@ -646,6 +646,9 @@ FJsEnvImpl::FJsEnvImpl(std::shared_ptr<IJSModuleLoader> InModuleLoader, std::sha
     DelegateProxiesCheckerHandler =
         FUETicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FJsEnvImpl::CheckDelegateProxies), 1);
 
+    TimerWheel.Reset(static_cast<uint64>(FPlatformTime::Seconds() * 1000.0));
+    TimerTickerHandle = FUETicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FJsEnvImpl::TickTimers), 0);
+
     ManualReleaseCallbackMap.Reset(Isolate, v8::Map::New(Isolate));
 
     UserObjectRetainer.SetName(TEXT("Puerts_UserObjectRetainer"));
@@ -725,6 +728,7 @@ FJsEnvImpl::~FJsEnvImpl()
     JsPromiseRejectCallback.Reset();
 
     FUETicker::GetCoreTicker().RemoveTicker(DelegateProxiesCheckerHandler);
+    FUETicker::GetCoreTicker().RemoveTicker(TimerTickerHandle);
 
     {
         auto Isolate = MainIsolate;
@@ -797,7 +801,9 @@ FJsEnvImpl::~FJsEnvImpl()
         }
 
         TsFunctionMap.Empty();
+        ResetTsFunctionCache();
         MixinFunctionMap.Empty();
+        NameStringCache.Reset();
 
 #if !defined(ENGINE_INDEPENDENT_JSENV)
         TsDynamicInvoker.Reset();
@@ -807,9 +813,9 @@ FJsEnvImpl::~FJsEnvImpl()
         for (auto Iter = TimerInfos.CreateIterator(); Iter; ++Iter)
         {
             Iter->Value.Callback.Reset();
-            FUETicker::GetCoreTicker().RemoveTicker(Iter->Value.TickerHandle);
         }
         TimerInfos.Empty();
+        TimerWheel.Reset(0);
 
 #if !defined(ENGINE_INDEPENDENT_JSENV)
         for (auto& GeneratedClass : GeneratedClasses)
@@ -1361,6 +1367,7 @@ void FJsEnvImpl::MakeSureInject(UTypeScriptGeneratedClass* TypeScriptGeneratedCl
                                             Function, {v8::UniquePersistent<v8::Function>(
                                                            Isolate, v8::Local<v8::Function>::Cast(MaybeValue.ToLocalChecked())),
                                                           std::make_unique<FFunctionTranslator>(Function, false)});
+                                        ResetTsFunctionCache();
                                     }
                                     else
                                     {
@@ -1904,6 +1911,15 @@ v8::Local<v8::Value> FJsEnvImpl::FindOrAddDelegate(v8::Isolate* Isolate, v8::Loc
         DelegateMap[DelegatePtr] = {v8::UniquePersistent<v8::Object>(Isolate, JSObject), TWeakObjectPtr<UObject>(Owner),
             DelegateProperty, MulticastDelegateProperty, Function, PassByPointer, nullptr,
             v8::UniquePersistent<v8::Array>(Isolate, v8::Array::New(Isolate))};
+        if (Owner)
+        {
+            DelegateOwnerIndex.FindOrAdd(Owner).AddUnique(DelegatePtr);
+        }
+        else
+        {
+            // no owner to wait for, stale from the start
+            PendingStaleDelegates.push_back(DelegatePtr);
+        }
         return JSObject;
     }
 }
@@ -2113,9 +2129,21 @@ void FJsEnvImpl::NotifyUObjectDeleted(const class UObjectBase* ObjectBase, int32
 
     GeneratedClasses.Remove((UClass*) ObjectBase);
 
-    TsFunctionMap.Remove((UFunction*) ObjectBase);
+    if (TsFunctionMap.Remove((UFunction*) ObjectBase) > 0)
+    {
+        ResetTsFunctionCache();
+    }
     MixinFunctionMap.Remove((UFunction*) ObjectBase);
     ContainerMeta.NotifyElementTypeDeleted((UField*) ObjectBase);
+    JsCallbackPrototypeMap.erase((UFunction*) ObjectBase);
+
+    auto OwnedDelegatesPtr = DelegateOwnerIndex.Find((UObject*) ObjectBase);
+    if (OwnedDelegatesPtr)
+    {
+        // the delegates are cleared in CheckDelegateProxies, the owner is half destroyed here
+        PendingStaleDelegates.insert(PendingStaleDelegates.end(), OwnedDelegatesPtr->begin(), OwnedDelegatesPtr->end());
+        DelegateOwnerIndex.Remove((UObject*) ObjectBase);
+    }
 
     auto CallbacksPtr = AutoReleaseCallbacksMap.Find((UObject*) ObjectBase);
     if (CallbacksPtr)
@@ -2272,13 +2300,13 @@ void FJsEnvImpl::InvokeTsMethod(UObject* ContextObject, UFunction* Function, FFr
 #ifdef THREAD_SAFE
     v8::Locker Locker(MainIsolate);
 #endif
-    auto FuncInfo = TsFunctionMap.Find(Function);
+    auto FuncInfo = FindTsFunction(Function);
     if (!FuncInfo)
     {
         auto Class = Cast<UTypeScriptGeneratedClass>(Function->GetOuterUClassUnchecked());
         MakeSureInject(Class, true, false);
         FinishInjection(Class);
-        FuncInfo = TsFunctionMap.Find(Function);
+        FuncInfo = FindTsFunction(Function);
         if (!FuncInfo)
         {
             Logger->Error(FString::Printf(TEXT("call %s::%s of %p fail: can not find Binded JavaScript Function"),
@@ -2362,6 +2390,31 @@ void FJsEnvImpl::NotifyReBind(UTypeScriptGeneratedClass* Class)
 }
 #endif
 
+FJsEnvImpl::TsFunctionInfo* FJsEnvImpl::FindTsFunction(UFunction* Function)
+{
+    const uint64 Hash = static_cast<uint64>(reinterpret_cast<UPTRINT>(Function)) * 0x9E3779B97F4A7C15ull;
+    FTsFunctionCacheEntry& Entry = TsFunctionCache[Hash >> (64 - TsFunctionCacheBits)];
+    if (Entry.Function != Function)
+    {
+        auto FuncInfo = TsFunctionMap.Find(Function);
+        if (!FuncInfo)
+        {
+            return nullptr;
+        }
+        Entry.Function = Function;
+        Entry.FuncInfo = FuncInfo;
+    }
+    return Entry.FuncInfo;
+}
+
+void FJsEnvImpl::ResetTsFunctionCache()
+{
+    for (auto& Entry : TsFunctionCache)
+    {
+        Entry = FTsFunctionCacheEntry();
+    }
+}
+
 void FJsEnvImpl::ExecuteDelegate(
     v8::Isolate* Isolate, v8::Local<v8::Context>& Context, const v8::FunctionCallbackInfo<v8::Value>& Info, void* DelegatePtr)
 {
@@ -2738,49 +2791,36 @@ bool FJsEnvImpl::CheckDelegateProxies(float Tick)
     v8::Locker Locker(Isolate);
 #endif
 
-    std::vector<void*> PendingToRemove;
-    for (auto& KV : DelegateMap)
+    // only the delegates queued by NotifyUObjectDeleted are visited, not the whole DelegateMap
+    uint32 Reclaimed = 0;
+    if (PendingStaleDelegates.size() > 0)
     {
-        if (!KV.second.Owner.IsValid())
-        {
-            PendingToRemove.push_back(KV.first);
-        }
-    }
+        std::vector<void*> PendingToRemove;
+        PendingToRemove.swap(PendingStaleDelegates);
 
-    if (PendingToRemove.size() > 0)
-    {
         v8::Isolate::Scope IsolateScope(Isolate);
         v8::HandleScope HandleScope(Isolate);
         v8::Local<v8::Context> Context = DefaultContext.Get(Isolate);
         v8::Context::Scope ContextScope(Context);
         for (int i = 0; i < PendingToRemove.size(); ++i)
         {
+            auto Iter = DelegateMap.find(PendingToRemove[i]);
+            // already removed, or the address was reused by a delegate of a live owner
+            if (Iter == DelegateMap.end() || Iter->second.Owner.IsValid())
+            {
+                continue;
+            }
             ClearDelegate(Isolate, Context, PendingToRemove[i]);
-            if (!DelegateMap[PendingToRemove[i]].PassByPointer)
+            if (!Iter->second.PassByPointer)
             {
                 delete ((FScriptDelegate*) PendingToRemove[i]);
             }
-            DelegateMap.erase(PendingToRemove[i]);
-        }
-    }
-
-    // Collecting invalid function translators to remove.
-    std::vector<UFunction*> PendingToRemoveJsCallbacks;
-    for (auto& KV : JsCallbackPrototypeMap)
-    {
-        if ((nullptr == KV.first) || (!KV.second->IsValid()))
-        {
-            PendingToRemoveJsCallbacks.push_back(KV.first);
-        }
-    }
-
-    if (PendingToRemoveJsCallbacks.size() > 0)
-    {
-        for (int32 i = 0; i < PendingToRemoveJsCallbacks.size(); i++)
-        {
-            JsCallbackPrototypeMap.erase(PendingToRemoveJsCallbacks[i]);
+            DelegateMap.erase(Iter);
+            ++Reclaimed;
         }
     }
+    DelegatesReclaimedLastPass = Reclaimed;
+    DelegatesReclaimedTotal += Reclaimed;
 
     return true;
 }
@@ -4116,19 +4156,25 @@ void FJsEnvImpl::SetFTickerDelegate(const v8::FunctionCallbackInfo<v8::Value>& I
     FTimerInfo& TimerInfo = TimerInfos.Emplace(DelegateHandleId, FTimerInfo());
     TimerInfo.Callback.Reset(Isolate, v8::Local<v8::Function>::Cast(Info[0]));
 
-    float Millisecond = Info[1]->NumberValue(Context).ToChecked();
-    float Delay = Millisecond / 1000.f;
-
-    TimerInfo.TickerHandle =
-        FUETicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this, DelegateHandleId, Continue](float)
-                                                 { return this->TimerCallback(DelegateHandleId, Continue); }),
-            Delay);
+    double Millisecond = Info[1]->NumberValue(Context).ToChecked();
+    // NaN and negative delays behave as 0
+    TimerInfo.IntervalMs = Millisecond > 0 ? static_cast<uint32>(FMath::Min(Millisecond, static_cast<double>(MAX_uint32))) : 0;
+    TimerInfo.ExpireMs = static_cast<uint64>(FPlatformTime::Seconds() * 1000.0) + TimerInfo.IntervalMs;
+    TimerInfo.Continue = Continue;
+    TimerInfo.ExpireMs = TimerWheel.Add(DelegateHandleId, TimerInfo.ExpireMs);
 
     Info.GetReturnValue().Set(DelegateHandleId);
 }
 
-bool FJsEnvImpl::TimerCallback(int DelegateHandleId, bool Continue)
+bool FJsEnvImpl::TickTimers(float Tick)
 {
+    const uint64 NowMs = static_cast<uint64>(FPlatformTime::Seconds() * 1000.0);
+    TimerWheel.Advance(NowMs, DueTimers);
+    if (DueTimers.Num() == 0)
+    {
+        return true;
+    }
+
     v8::Isolate* Isolate = MainIsolate;
 #ifdef SINGLE_THREAD_VERIFY
     ensureMsgf(BoundThreadId == FPlatformTLS::GetCurrentThreadId(), TEXT("Access by illegal thread!"));
@@ -4142,43 +4188,56 @@ bool FJsEnvImpl::TimerCallback(int DelegateHandleId, bool Continue)
     v8::Local<v8::Context> Context = DefaultContext.Get(Isolate);
     v8::Context::Scope ContextScope(Context);
 
-    FTimerInfo* PTimeInfo = TimerInfos.Find(DelegateHandleId);
-    if (!PTimeInfo)
+    for (const FTimerWheel::FEntry& Entry : DueTimers)
     {
-        Logger->Warn(FString::Printf(TEXT("Try to callback a invalid timer: %d"), DelegateHandleId));
-        return false;
-    }
+        // cleared, or an entry left behind by a reschedule
+        FTimerInfo* PTimeInfo = TimerInfos.Find(Entry.Id);
+        if (!PTimeInfo || PTimeInfo->ExpireMs != Entry.Expire)
+        {
+            continue;
+        }
 
-    auto OriginHandle = PTimeInfo->TickerHandle;
-    v8::Local<v8::Function> Function = TimerInfos[DelegateHandleId].Callback.Get(Isolate);
+        const uint64 LateMs = NowMs > PTimeInfo->ExpireMs ? NowMs - PTimeInfo->ExpireMs : 0;
+        ++TimerFiredCount;
+        TimerTotalLateMs += LateMs;
+        TimerMaxLateMs = FMath::Max(TimerMaxLateMs, LateMs);
 
-    v8::TryCatch TryCatch(Isolate);
-    (void) (Function->Call(Context, Context->Global(), 0, nullptr));
+        v8::HandleScope CallbackScope(Isolate);
+        v8::Local<v8::Function> Function = PTimeInfo->Callback.Get(Isolate);
 
-    if (TryCatch.HasCaught())
-    {
-        FString Message =
-            FString::Printf(TEXT("Exception in Timer Callback: %s"), *(FV8Utils::TryCatchToString(Isolate, &TryCatch)));
-        Logger->Error(Message);
-    }
+        v8::TryCatch TryCatch(Isolate);
+        (void) (Function->Call(Context, Context->Global(), 0, nullptr));
 
-    auto ClearInCallback = !TimerInfos.Contains(DelegateHandleId) || (OriginHandle != TimerInfos[DelegateHandleId].TickerHandle);
+        if (TryCatch.HasCaught())
+        {
+            FString Message =
+                FString::Printf(TEXT("Exception in Timer Callback: %s"), *(FV8Utils::TryCatchToString(Isolate, &TryCatch)));
+            Logger->Error(Message);
+        }
 
-    if (!Continue && !ClearInCallback)
-    {
-        RemoveFTickerDelegateHandle(DelegateHandleId);
+        // the callback may have added or cleared timers, PTimeInfo is not valid anymore
+        PTimeInfo = TimerInfos.Find(Entry.Id);
+        if (!PTimeInfo)
+        {
+            continue;
+        }
+        if (PTimeInfo->Continue)
+        {
+            PTimeInfo->ExpireMs = TimerWheel.Add(Entry.Id, NowMs + FMath::Max(PTimeInfo->IntervalMs, 1u));
+        }
+        else
+        {
+            TimerInfos.Remove(Entry.Id);
+        }
     }
+    DueTimers.Reset();
 
-    return Continue && !ClearInCallback;
+    return true;
 }
 
 void FJsEnvImpl::RemoveFTickerDelegateHandle(int DelegateHandleId)
 {
-    if (!TimerInfos.Contains(DelegateHandleId))
-    {
-        return;
-    }
-    FUETicker::GetCoreTicker().RemoveTicker(TimerInfos[DelegateHandleId].TickerHandle);
+    // the entry in TimerWheel is skipped when it comes due
     TimerInfos.Remove(DelegateHandleId);
 }
 
@@ -4573,6 +4632,54 @@ void FJsEnvImpl::DumpStatisticsLog(const v8::FunctionCallbackInfo<v8::Value>& In
 
     Logger->Info(StatisticsLog);
 #endif    // !WITH_QUICKJS
+
+    Logger->Info(FString::Printf(TEXT("------------------------\n"
+                                      "Dump Statistics of Timers:\n"
+                                      "pending_timers: %d\n"
+                                      "wheel_entries: %d\n"
+                                      "fired_timers: %llu\n"
+                                      "average_late_ms: %llu\n"
+                                      "max_late_ms: %llu\n"
+                                      "------------------------\n"),
+        TimerInfos.Num(), TimerWheel.GetNum(), TimerFiredCount, TimerFiredCount > 0 ? TimerTotalLateMs / TimerFiredCount : 0,
+        TimerMaxLateMs));
+
+    Logger->Info(FString::Printf(TEXT("------------------------\n"
+                                      "Dump Statistics of Delegates:\n"
+                                      "bound_delegates: %d\n"
+                                      "pending_stale_delegates: %d\n"
+                                      "reclaimed_last_pass: %u\n"
+                                      "reclaimed_total: %llu\n"
+                                      "------------------------\n"),
+        static_cast<int32>(DelegateMap.size()), static_cast<int32>(PendingStaleDelegates.size()), DelegatesReclaimedLastPass,
+        DelegatesReclaimedTotal));
+
+    int32 LazyFunctionNum = 0;
+    int32 MaterializedFunctionNum = 0;
+    for (auto& KV : TypeReflectionMap)
+    {
+        LazyFunctionNum += KV.Value->LazyFunctions.Num();
+        MaterializedFunctionNum += KV.Value->FunctionsMap.Num() + KV.Value->MethodsMap.Num();
+    }
+    Logger->Info(FString::Printf(TEXT("------------------------\n"
+                                      "Dump Statistics of Reflection:\n"
+                                      "loaded_types: %d\n"
+                                      "lazy_functions: %d\n"
+                                      "materialized_functions: %d\n"
+                                      "------------------------\n"),
+        TypeReflectionMap.Num(), LazyFunctionNum, MaterializedFunctionNum));
+
+    Logger->Info(FString::Printf(TEXT("------------------------\n"
+                                      "Dump Statistics of FName Strings:\n"
+                                      "cached_names: %d\n"
+                                      "name_to_string_hits: %llu\n"
+                                      "name_to_string_misses: %llu\n"
+                                      "name_to_string_evictions: %llu\n"
+                                      "string_to_name_hits: %llu\n"
+                                      "string_to_name_misses: %llu\n"
+                                      "------------------------\n"),
+        NameStringCache.Num(), NameStringCache.Hits, NameStringCache.Misses, NameStringCache.Evictions,
+        NameStringCache.ReverseHits, NameStringCache.ReverseMisses));
 }
 
 #if USE_WASM3
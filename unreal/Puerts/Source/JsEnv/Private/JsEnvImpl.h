@@ -22,6 +22,8 @@
 #include "UECompatible.h"
 #include "ContainerMeta.h"
 #include "ObjectCacheNode.h"
+#include "TimerWheel.h"
+#include "NameStringCache.h"
 #include <unordered_map>
 
 #if ENGINE_MINOR_VERSION >= 25 || ENGINE_MAJOR_VERSION > 4
@@ -228,6 +230,16 @@ public:
     virtual v8::Local<v8::Value> AddSoftObjectPtr(v8::Isolate* Isolate, v8::Local<v8::Context> Context,
         FSoftObjectPtr* SoftObjectPtr, UClass* Class, bool IsSoftClass) override;
 
+    virtual v8::Local<v8::String> NameToString(v8::Isolate* Isolate, const FName& Name) override
+    {
+        return NameStringCache.ToV8String(Isolate, Name);
+    }
+
+    virtual FName StringToName(v8::Isolate* Isolate, v8::Local<v8::Value> Value) override
+    {
+        return NameStringCache.ToFName(Isolate, Value);
+    }
+
     bool CheckDelegateProxies(float Tick);
 
     virtual v8::Local<v8::Value> CreateArray(
@@ -316,7 +328,7 @@ private:
 
     void SetFTickerDelegate(const v8::FunctionCallbackInfo<v8::Value>& Info, bool Continue);
 
-    bool TimerCallback(int DelegateHandleId, bool Continue);
+    bool TickTimers(float Tick);
 
     void RemoveFTickerDelegateHandle(int HandleId);
 
@@ -692,8 +704,36 @@ private:
 
     std::map<void*, DelegateObjectInfo> DelegateMap;
 
+    // owner -> delegates living in it, lets NotifyUObjectDeleted queue the stale ones instead of CheckDelegateProxies
+    // scanning the whole DelegateMap
+    TMap<UObject*, TArray<void*>> DelegateOwnerIndex;
+
+    std::vector<void*> PendingStaleDelegates;
+
+    uint32 DelegatesReclaimedLastPass = 0;
+
+    uint64 DelegatesReclaimedTotal = 0;
+
     TMap<UFunction*, TsFunctionInfo> TsFunctionMap;
 
+    // direct mapped UFunction -> TsFunctionMap entry, spares InvokeTsMethod the map lookup.
+    // TMap values move when the map changes, every Add/Remove/Empty must be followed by ResetTsFunctionCache
+    struct FTsFunctionCacheEntry
+    {
+        UFunction* Function = nullptr;
+        TsFunctionInfo* FuncInfo = nullptr;
+    };
+
+    static constexpr int32 TsFunctionCacheBits = 6;
+
+    FTsFunctionCacheEntry TsFunctionCache[1 << TsFunctionCacheBits];
+
+    TsFunctionInfo* FindTsFunction(UFunction* Function);
+
+    void ResetTsFunctionCache();
+
+    FNameStringCache NameStringCache;
+
     TMap<UFunction*, v8::UniquePersistent<v8::Function>> MixinFunctionMap;
 
     std::map<UStruct*, std::vector<UFunction*>> ExtensionMethodsMap;
@@ -703,11 +743,26 @@ private:
     struct FTimerInfo
     {
         v8::Global<v8::Function> Callback;
-        FUETickDelegateHandle TickerHandle;
+        uint64 ExpireMs = 0;
+        uint32 IntervalMs = 0;
+        bool Continue = false;
     };
     uint32_t TimerID = 0;
     TMap<uint32_t, FTimerInfo> TimerInfos;
 
+    // all timers of this env share one wheel driven by TimerTickerHandle
+    FTimerWheel TimerWheel;
+
+    TArray<FTimerWheel::FEntry> DueTimers;
+
+    FUETickDelegateHandle TimerTickerHandle;
+
+    uint64 TimerFiredCount = 0;
+
+    uint64 TimerTotalLateMs = 0;
+
+    uint64 TimerMaxLateMs = 0;
+
     FUETickDelegateHandle DelegateProxiesCheckerHandler;
 
     V8Inspector* Inspector;
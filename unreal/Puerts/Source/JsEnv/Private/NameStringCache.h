@@ -0,0 +1,201 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NamespaceDef.h"
+#include "V8Utils.h"
+
+PRAGMA_DISABLE_UNDEFINED_IDENTIFIER_WARNINGS
+#pragma warning(push, 0)
+#include "v8.h"
+#pragma warning(pop)
+PRAGMA_ENABLE_UNDEFINED_IDENTIFIER_WARNINGS
+
+namespace PUERTS_NAMESPACE
+{
+// FName <-> js string conversions of one isolate.
+// FName -> string keeps the most recently used names as internalized strings, least recently used is evicted first.
+// FName equality is ComparisonIndex + Number, which is exactly what the string is built from.
+// string -> FName is direct mapped on the string hash, a slot is taken over by the next string hashing there.
+class FNameStringCache
+{
+public:
+    explicit FNameStringCache(int32 InCapacity = 4096) : Capacity(InCapacity)
+    {
+    }
+
+    v8::Local<v8::String> ToV8String(v8::Isolate* Isolate, const FName& Name)
+    {
+#ifdef WITH_QUICKJS
+        return FV8Utils::ToV8String(Isolate, Name);
+#else
+        if (int32* IndexPtr = NameToNode.Find(Name))
+        {
+            ++Hits;
+            MoveToFront(*IndexPtr);
+            return Nodes[*IndexPtr].Value.Get(Isolate);
+        }
+        ++Misses;
+
+        const FString NameString = FV8Utils::NameToString(Name);
+        auto Result =
+            v8::String::NewFromTwoByte(Isolate, TCHAR_TO_UTF16(*NameString), v8::NewStringType::kInternalized).ToLocalChecked();
+        int32 Index;
+        if (Nodes.Num() < Capacity)
+        {
+            Index = Nodes.AddDefaulted();
+        }
+        else
+        {
+            Index = Tail;
+            Unlink(Index);
+            NameToNode.Remove(Nodes[Index].Name);
+            ++Evictions;
+        }
+        FNode& Node = Nodes[Index];
+        Node.Name = Name;
+        Node.Value.Reset(Isolate, Result);
+        LinkFront(Index);
+        NameToNode.Add(Name, Index);
+        return Result;
+#endif
+    }
+
+    FName ToFName(v8::Isolate* Isolate, v8::Local<v8::Value> Value)
+    {
+#ifdef WITH_QUICKJS
+        return FV8Utils::ToFName(Isolate, Value);
+#else
+        if (!Value->IsString())
+        {
+            return FV8Utils::ToFName(Isolate, Value);
+        }
+        auto String = v8::Local<v8::String>::Cast(Value);
+        FReverseEntry& Entry = ReverseEntries[String->GetIdentityHash() & (ReverseSize - 1)];
+        if (!Entry.String.IsEmpty() && Entry.String.Get(Isolate)->StrictEquals(String))
+        {
+            ++ReverseHits;
+            return Entry.Name;
+        }
+        ++ReverseMisses;
+        FName Name = FV8Utils::ToFName(Isolate, String);
+        Entry.String.Reset(Isolate, String);
+        Entry.Name = Name;
+        return Name;
+#endif
+    }
+
+    // must run before the isolate goes away
+    void Reset()
+    {
+        Nodes.Empty();
+        NameToNode.Empty();
+        Head = INDEX_NONE;
+        Tail = INDEX_NONE;
+        for (auto& Entry : ReverseEntries)
+        {
+            Entry.String.Reset();
+            Entry.Name = NAME_None;
+        }
+    }
+
+    int32 Num() const
+    {
+        return Nodes.Num();
+    }
+
+    uint64 Hits = 0;
+
+    uint64 Misses = 0;
+
+    uint64 Evictions = 0;
+
+    uint64 ReverseHits = 0;
+
+    uint64 ReverseMisses = 0;
+
+private:
+    struct FNode
+    {
+        FName Name;
+        v8::Global<v8::String> Value;
+        int32 Prev = INDEX_NONE;
+        int32 Next = INDEX_NONE;
+    };
+
+    struct FReverseEntry
+    {
+        v8::Global<v8::String> String;
+        FName Name;
+    };
+
+    static constexpr int32 ReverseSize = 1024;
+
+    void Unlink(int32 Index)
+    {
+        FNode& Node = Nodes[Index];
+        if (Node.Prev != INDEX_NONE)
+        {
+            Nodes[Node.Prev].Next = Node.Next;
+        }
+        else
+        {
+            Head = Node.Next;
+        }
+        if (Node.Next != INDEX_NONE)
+        {
+            Nodes[Node.Next].Prev = Node.Prev;
+        }
+        else
+        {
+            Tail = Node.Prev;
+        }
+        Node.Prev = INDEX_NONE;
+        Node.Next = INDEX_NONE;
+    }
+
+    void LinkFront(int32 Index)
+    {
+        FNode& Node = Nodes[Index];
+        Node.Prev = INDEX_NONE;
+        Node.Next = Head;
+        if (Head != INDEX_NONE)
+        {
+            Nodes[Head].Prev = Index;
+        }
+        Head = Index;
+        if (Tail == INDEX_NONE)
+        {
+            Tail = Index;
+        }
+    }
+
+    void MoveToFront(int32 Index)
+    {
+        if (Head != Index)
+        {
+            Unlink(Index);
+            LinkFront(Index);
+        }
+    }
+
+    int32 Capacity;
+
+    TArray<FNode> Nodes;
+
+    TMap<FName, int32> NameToNode;
+
+    int32 Head = INDEX_NONE;
+
+    int32 Tail = INDEX_NONE;
+
+    FReverseEntry ReverseEntries[ReverseSize];
+};
+}    // namespace PUERTS_NAMESPACE
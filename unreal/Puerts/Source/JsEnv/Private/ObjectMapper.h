@@ -114,6 +114,11 @@ public:
 
     virtual v8::Local<v8::Value> AddSoftObjectPtr(
         v8::Isolate* Isolate, v8::Local<v8::Context> Context, FSoftObjectPtr* SoftObjectPtr, UClass* Class, bool IsSoftClass) = 0;
+
+    // FName conversions go through a per env cache
+    virtual v8::Local<v8::String> NameToString(v8::Isolate* Isolate, const FName& Name) = 0;
+
+    virtual FName StringToName(v8::Isolate* Isolate, v8::Local<v8::Value> Value) = 0;
 };
 #endif
 
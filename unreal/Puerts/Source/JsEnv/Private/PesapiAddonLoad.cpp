@@ -64,7 +64,11 @@ static pesapi_func_ptr funcs[] = {(pesapi_func_ptr) &pesapi_create_null, (pesapi
     (pesapi_func_ptr) &pesapi_set_method_info, (pesapi_func_ptr) &pesapi_set_property_info, (pesapi_func_ptr) &pesapi_define_class,
     (pesapi_func_ptr) &pesapi_get_class_data, (pesapi_func_ptr) &pesapi_trace_native_object_lifecycle,
     (pesapi_func_ptr) &pesapi_on_class_not_found, (pesapi_func_ptr) &pesapi_class_type_info,
-    (pesapi_func_ptr) &pesapi_find_type_id};
+    (pesapi_func_ptr) &pesapi_find_type_id, (pesapi_func_ptr) &pesapi_create_key, (pesapi_func_ptr) &pesapi_release_key,
+    (pesapi_func_ptr) &pesapi_get_property_by_key, (pesapi_func_ptr) &pesapi_set_property_by_key,
+    (pesapi_func_ptr) &pesapi_get_properties, (pesapi_func_ptr) &pesapi_begin_batch, (pesapi_func_ptr) &pesapi_end_batch,
+    (pesapi_func_ptr) &pesapi_create_array_from_buffer, (pesapi_func_ptr) &pesapi_get_array_elements,
+    (pesapi_func_ptr) &pesapi_set_array_elements};
 MSVC_PRAGMA(warning(pop))
 
 EXTERN_C_START
@@ -0,0 +1,208 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+// bulk numeric array transfer behind pesapi_create_array_from_buffer / pesapi_get_array_elements /
+// pesapi_set_array_elements, only depends on v8
+
+#include "NamespaceDef.h"
+
+PRAGMA_DISABLE_UNDEFINED_IDENTIFIER_WARNINGS
+#pragma warning(push, 0)
+#include "v8.h"
+#pragma warning(pop)
+PRAGMA_ENABLE_UNDEFINED_IDENTIFIER_WARNINGS
+
+#include <cstring>
+#include <vector>
+
+namespace v8impl
+{
+template <typename T>
+struct ArrayElement;
+
+template <>
+struct ArrayElement<int32_t>
+{
+    static bool IsSameTypedArray(v8::Local<v8::Value> value)
+    {
+        return value->IsInt32Array();
+    }
+    static v8::Local<v8::Value> ToV8(v8::Isolate* isolate, int32_t value)
+    {
+        return v8::Integer::New(isolate, value);
+    }
+    static int32_t FromV8(v8::Local<v8::Context> context, v8::Local<v8::Value> value)
+    {
+        return value->Int32Value(context).FromMaybe(0);
+    }
+};
+
+template <>
+struct ArrayElement<uint32_t>
+{
+    static bool IsSameTypedArray(v8::Local<v8::Value> value)
+    {
+        return value->IsUint32Array();
+    }
+    static v8::Local<v8::Value> ToV8(v8::Isolate* isolate, uint32_t value)
+    {
+        return v8::Integer::NewFromUnsigned(isolate, value);
+    }
+    static uint32_t FromV8(v8::Local<v8::Context> context, v8::Local<v8::Value> value)
+    {
+        return value->Uint32Value(context).FromMaybe(0);
+    }
+};
+
+template <>
+struct ArrayElement<float>
+{
+    static bool IsSameTypedArray(v8::Local<v8::Value> value)
+    {
+        return value->IsFloat32Array();
+    }
+    static v8::Local<v8::Value> ToV8(v8::Isolate* isolate, float value)
+    {
+        return v8::Number::New(isolate, value);
+    }
+    static float FromV8(v8::Local<v8::Context> context, v8::Local<v8::Value> value)
+    {
+        return static_cast<float>(value->NumberValue(context).FromMaybe(0));
+    }
+};
+
+template <>
+struct ArrayElement<double>
+{
+    static bool IsSameTypedArray(v8::Local<v8::Value> value)
+    {
+        return value->IsFloat64Array();
+    }
+    static v8::Local<v8::Value> ToV8(v8::Isolate* isolate, double value)
+    {
+        return v8::Number::New(isolate, value);
+    }
+    static double FromV8(v8::Local<v8::Context> context, v8::Local<v8::Value> value)
+    {
+        return value->NumberValue(context).FromMaybe(0);
+    }
+};
+
+// DataTransfer::GetArrayBufferData without the engine headers, so the helpers build in the native benchmarks too
+inline char* TypedArrayData(v8::Local<v8::TypedArray> typedArray)
+{
+    auto buffer = typedArray->Buffer();
+#if defined(HAS_ARRAYBUFFER_NEW_WITHOUT_STL)
+    size_t length;
+    void* data = v8::ArrayBuffer_Get_Data(buffer, length);
+#elif USING_IN_UNREAL_ENGINE
+    void* data = buffer->GetContents().Data();
+#else
+    void* data = buffer->GetBackingStore()->Data();
+#endif
+    return static_cast<char*>(data) + typedArray->ByteOffset();
+}
+
+template <typename T>
+v8::Local<v8::Array> CreateArrayFromBuffer(v8::Local<v8::Context> context, const T* data, size_t count)
+{
+    auto isolate = context->GetIsolate();
+    std::vector<v8::Local<v8::Value>> elements(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        elements[i] = ArrayElement<T>::ToV8(isolate, data[i]);
+    }
+    return v8::Array::New(isolate, elements.data(), count);
+}
+
+inline bool GetArrayLikeLength(v8::Local<v8::Value> value, size_t& length)
+{
+    if (value->IsArray())
+    {
+        length = value.As<v8::Array>()->Length();
+        return true;
+    }
+    if (value->IsTypedArray())
+    {
+        length = value.As<v8::TypedArray>()->Length();
+        return true;
+    }
+    return false;
+}
+
+template <typename T>
+size_t GetArrayElements(v8::Local<v8::Context> context, v8::Local<v8::Value> value, uint32_t start, T* out, size_t count)
+{
+    size_t length;
+    if (!GetArrayLikeLength(value, length) || start >= length)
+    {
+        return 0;
+    }
+    if (count > length - start)
+    {
+        count = length - start;
+    }
+    if (ArrayElement<T>::IsSameTypedArray(value))
+    {
+        ::memcpy(out, TypedArrayData(value.As<v8::TypedArray>()) + start * sizeof(T), count * sizeof(T));
+        return count;
+    }
+    auto object = value.As<v8::Object>();
+    for (size_t i = 0; i < count; ++i)
+    {
+        v8::Local<v8::Value> element;
+        if (object->Get(context, start + static_cast<uint32_t>(i)).ToLocal(&element))
+        {
+            out[i] = ArrayElement<T>::FromV8(context, element);
+        }
+        else
+        {
+            out[i] = T();
+        }
+    }
+    return count;
+}
+
+template <typename T>
+size_t SetArrayElements(v8::Local<v8::Context> context, v8::Local<v8::Value> value, uint32_t start, const T* data, size_t count)
+{
+    size_t length;
+    if (!GetArrayLikeLength(value, length))
+    {
+        return 0;
+    }
+    if (value->IsTypedArray())
+    {
+        if (start >= length)
+        {
+            return 0;
+        }
+        if (count > length - start)
+        {
+            count = length - start;
+        }
+        if (ArrayElement<T>::IsSameTypedArray(value))
+        {
+            ::memcpy(TypedArrayData(value.As<v8::TypedArray>()) + start * sizeof(T), data, count * sizeof(T));
+            return count;
+        }
+    }
+    auto isolate = context->GetIsolate();
+    auto object = value.As<v8::Object>();
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (object->Set(context, start + static_cast<uint32_t>(i), ArrayElement<T>::ToV8(isolate, data[i])).IsNothing())
+        {
+            return i;
+        }
+    }
+    return count;
+}
+}    // namespace v8impl
@@ -12,11 +12,14 @@
 #include "DataTransfer.h"
 #include "JSClassRegister.h"
 #include "ObjectMapper.h"
+#include "CppObjectMapper.h"
+#include "PesapiV8ArrayElements.h"
 
 #include <string>
 #include <sstream>
 #include <vector>
 #include <cstring>
+#include <memory>
 #include "PString.h"
 
 struct pesapi_env_ref__
@@ -49,16 +52,33 @@ struct pesapi_value_ref__ : pesapi_env_ref__
 
 struct pesapi_scope__
 {
-    explicit pesapi_scope__(v8::Isolate* isolate) : scope(isolate), trycatch(isolate)
+    explicit pesapi_scope__(v8::Isolate* isolate, bool enter) : scope(isolate), trycatch(isolate), entered(enter)
     {
     }
     v8::HandleScope scope;
     v8::TryCatch trycatch;
-    puerts::PString errinfo;
+    // only allocated when the exception is asked for
+    std::unique_ptr<puerts::PString> errinfo;
+    // false if opened inside a batch of the same env, the isolate and context were entered by the batch
+    bool entered;
 };
 
 static_assert(sizeof(pesapi_scope_memory) >= sizeof(pesapi_scope__), "sizeof(pesapi_scope__) > sizeof(pesapi_scope_memory__)");
 
+struct pesapi_key__
+{
+    explicit pesapi_key__(v8::Isolate* isolate, v8::Local<v8::String> key)
+        : key_persistent(isolate, key)
+        , isolate(isolate)
+        , env_life_cycle_tracker(puerts::DataTransfer::GetJsEnvLifeCycleTracker(isolate))
+    {
+    }
+
+    v8::Persistent<v8::String> key_persistent;
+    v8::Isolate* const isolate;
+    std::weak_ptr<int> env_life_cycle_tracker;
+};
+
 namespace v8impl
 {
 static_assert(sizeof(v8::Local<v8::Value>) == sizeof(pesapi_value), "Cannot convert between v8::Local<v8::Value> and pesapi_value");
@@ -524,16 +544,121 @@ void pesapi_release_env_ref(pesapi_env_ref env_ref)
     }
 }
 
+namespace v8impl
+{
+// pesapi_open_scope runs for every native to js call, its blocks are recycled per thread instead of new/delete
+struct ScopeMemoryPool
+{
+    ~ScopeMemoryPool()
+    {
+        for (auto memory : free_list)
+        {
+            delete memory;
+        }
+    }
+
+    pesapi_scope_memory* Alloc()
+    {
+        if (free_list.empty())
+        {
+            return new pesapi_scope_memory;
+        }
+        auto memory = free_list.back();
+        free_list.pop_back();
+        return memory;
+    }
+
+    void Free(pesapi_scope_memory* memory)
+    {
+        if (free_list.size() < 16)
+        {
+            free_list.push_back(memory);
+        }
+        else
+        {
+            delete memory;
+        }
+    }
+
+    std::vector<pesapi_scope_memory*> free_list;
+};
+
+static thread_local ScopeMemoryPool scope_memory_pool;
+
+// the env whose isolate and context stay entered between pesapi_begin_batch and pesapi_end_batch on this thread
+struct BatchState
+{
+    pesapi_env_ref env_ref = nullptr;
+    int depth = 0;
+};
+
+static thread_local BatchState batch_state;
+
+inline bool InBatchOf(pesapi_env_ref env_ref)
+{
+    if (!batch_state.env_ref)
+    {
+        return false;
+    }
+    if (batch_state.env_ref == env_ref)
+    {
+        return true;
+    }
+    // the handles of a dead env are freed, only compare contexts while both are alive
+    return !batch_state.env_ref->env_life_cycle_tracker.expired() && !env_ref->env_life_cycle_tracker.expired() &&
+           batch_state.env_ref->context_persistent == env_ref->context_persistent;
+}
+
+// the batch only stands in for Enter while its isolate is current and nothing else has been entered over its context
+inline bool BatchIsCurrent(pesapi_env_ref env_ref)
+{
+    auto isolate = env_ref->isolate;
+    if (!InBatchOf(env_ref) || v8::Isolate::GetCurrent() != isolate)
+    {
+        return false;
+    }
+    v8::HandleScope scope(isolate);
+    return isolate->GetCurrentContext() == batch_state.env_ref->context_persistent.Get(isolate);
+}
+
+inline pesapi_scope OpenScope(pesapi_env_ref env_ref, void* memory)
+{
+    const bool enter = !BatchIsCurrent(env_ref);
+    if (enter)
+    {
+        env_ref->isolate->Enter();
+    }
+    auto scope = new (memory) pesapi_scope__(env_ref->isolate, enter);
+    if (enter)
+    {
+        env_ref->context_persistent.Get(env_ref->isolate)->Enter();
+    }
+    return scope;
+}
+
+inline void CloseScope(pesapi_scope scope)
+{
+    auto isolate = scope->scope.GetIsolate();
+    const bool entered = scope->entered;
+    if (entered)
+    {
+        isolate->GetCurrentContext()->Exit();
+    }
+    scope->~pesapi_scope__();
+    if (entered)
+    {
+        isolate->Exit();
+    }
+}
+}    // namespace v8impl
+
 pesapi_scope pesapi_open_scope(pesapi_env_ref env_ref)
 {
     if (env_ref->env_life_cycle_tracker.expired())
     {
         return nullptr;
     }
-    env_ref->isolate->Enter();
-    auto scope = new pesapi_scope__(env_ref->isolate);
-    env_ref->context_persistent.Get(env_ref->isolate)->Enter();
-    return scope;
+    return v8impl::OpenScope(env_ref, v8impl::scope_memory_pool.Alloc());
 }
 
 pesapi_scope pesapi_open_scope_placement(pesapi_env_ref env_ref, struct pesapi_scope_memory* memory)
@@ -542,10 +667,7 @@ pesapi_scope pesapi_open_scope_placement(pesapi_env_ref env_ref, struct pesapi_s
     {
         return nullptr;
     }
-    env_ref->isolate->Enter();
-    auto scope = new (memory) pesapi_scope__(env_ref->isolate);
-    env_ref->context_persistent.Get(env_ref->isolate)->Enter();
-    return scope;
+    return v8impl::OpenScope(env_ref, memory);
 }
 
 bool pesapi_has_caught(pesapi_scope scope)
@@ -557,7 +679,12 @@ const char* pesapi_get_exception_as_string(pesapi_scope scope, bool with_stack)
 {
     if (!scope)
         return nullptr;
-    scope->errinfo = *v8::String::Utf8Value(scope->scope.GetIsolate(), scope->trycatch.Exception());
+    if (!scope->errinfo)
+    {
+        scope->errinfo.reset(new puerts::PString());
+    }
+    auto& errinfo = *scope->errinfo;
+    errinfo = *v8::String::Utf8Value(scope->scope.GetIsolate(), scope->trycatch.Exception());
     if (with_stack)
     {
         auto isolate = scope->scope.GetIsolate();
@@ -568,7 +695,7 @@ const char* pesapi_get_exception_as_string(pesapi_scope scope, bool with_stack)
         std::ostringstream stm;
         v8::String::Utf8Value fileName(isolate, message->GetScriptResourceName());
         int lineNum = message->GetLineNumber(context).FromJust();
-        stm << *fileName << ":" << lineNum << ": " << scope->errinfo.c_str();
+        stm << *fileName << ":" << lineNum << ": " << errinfo.c_str();
 
         stm << std::endl;
 
@@ -579,31 +706,92 @@ const char* pesapi_get_exception_as_string(pesapi_scope scope, bool with_stack)
             v8::String::Utf8Value stackTraceVal(isolate, stackTrace);
             stm << std::endl << *stackTraceVal;
         }
-        scope->errinfo = stm.str().c_str();
+        errinfo = stm.str().c_str();
     }
-    return scope->errinfo.c_str();
+    return errinfo.c_str();
 }
 
 void pesapi_close_scope(pesapi_scope scope)
 {
     if (!scope)
         return;
-    auto isolate = scope->scope.GetIsolate();
-    isolate->GetCurrentContext()->Exit();
-    delete (scope);
-    isolate->Exit();
+    v8impl::CloseScope(scope);
+    v8impl::scope_memory_pool.Free(reinterpret_cast<pesapi_scope_memory*>(scope));
 }
 
 void pesapi_close_scope_placement(pesapi_scope scope)
 {
     if (!scope)
         return;
-    auto isolate = scope->scope.GetIsolate();
-    isolate->GetCurrentContext()->Exit();
-    scope->~pesapi_scope__();
-    isolate->Exit();
+    v8impl::CloseScope(scope);
 }
 
+bool pesapi_begin_batch(pesapi_env_ref env_ref)
+{
+    if (v8impl::batch_state.env_ref && v8impl::batch_state.env_ref->env_life_cycle_tracker.expired())
+    {
+        // the env died inside a batch opened on another thread, EndPesapiBatch only ends the one of the dying thread
+        pesapi_release_env_ref(v8impl::batch_state.env_ref);
+        v8impl::batch_state.env_ref = nullptr;
+        v8impl::batch_state.depth = 0;
+    }
+    if (v8impl::batch_state.env_ref)
+    {
+        if (!v8impl::InBatchOf(env_ref))
+        {
+            return false;
+        }
+        ++v8impl::batch_state.depth;
+        return true;
+    }
+    if (env_ref->env_life_cycle_tracker.expired())
+    {
+        return false;
+    }
+    auto isolate = env_ref->isolate;
+    isolate->Enter();
+    {
+        v8::HandleScope scope(isolate);
+        env_ref->context_persistent.Get(isolate)->Enter();
+    }
+    v8impl::batch_state.env_ref = pesapi_duplicate_env_ref(env_ref);
+    v8impl::batch_state.depth = 1;
+    return true;
+}
+
+void pesapi_end_batch(pesapi_env_ref env_ref)
+{
+    if (!v8impl::InBatchOf(env_ref) || --v8impl::batch_state.depth > 0)
+    {
+        return;
+    }
+    auto batch_env_ref = v8impl::batch_state.env_ref;
+    v8impl::batch_state.env_ref = nullptr;
+    if (!batch_env_ref->env_life_cycle_tracker.expired())
+    {
+        auto isolate = batch_env_ref->isolate;
+        {
+            v8::HandleScope scope(isolate);
+            batch_env_ref->context_persistent.Get(isolate)->Exit();
+        }
+        isolate->Exit();
+    }
+    pesapi_release_env_ref(batch_env_ref);
+}
+
+namespace PUERTS_NAMESPACE
+{
+void EndPesapiBatch(v8::Isolate* Isolate)
+{
+    auto batch_env_ref = v8impl::batch_state.env_ref;
+    if (batch_env_ref && batch_env_ref->isolate == Isolate)
+    {
+        v8impl::batch_state.depth = 1;
+        pesapi_end_batch(batch_env_ref);
+    }
+}
+}    // namespace PUERTS_NAMESPACE
+
 pesapi_value_ref pesapi_create_value_ref(pesapi_env env, pesapi_value pvalue, uint32_t internal_field_count)
 {
     auto context = v8impl::V8LocalContextFromPesapiEnv(env);
@@ -729,6 +917,145 @@ bool pesapi_set_private(pesapi_env env, pesapi_value pobject, void* ptr)
     return true;
 }
 
+pesapi_key pesapi_create_key(pesapi_env env, const char* key)
+{
+    auto context = v8impl::V8LocalContextFromPesapiEnv(env);
+    auto isolate = context->GetIsolate();
+    return new pesapi_key__(isolate, v8::String::NewFromUtf8(isolate, key, v8::NewStringType::kInternalized).ToLocalChecked());
+}
+
+void pesapi_release_key(pesapi_key key)
+{
+    if (key->env_life_cycle_tracker.expired())
+    {
+#if V8_MAJOR_VERSION < 11
+        key->key_persistent.Empty();
+        delete key;
+#else
+        ::operator delete(static_cast<void*>(key));
+#endif
+    }
+    else
+    {
+        key->key_persistent.Reset();
+        delete key;
+    }
+}
+
+pesapi_value pesapi_get_property_by_key(pesapi_env env, pesapi_value pobject, pesapi_key key)
+{
+    auto context = v8impl::V8LocalContextFromPesapiEnv(env);
+    auto object = v8impl::V8LocalValueFromPesapiValue(pobject);
+    if (object->IsObject())
+    {
+        auto MaybeValue = object.As<v8::Object>()->Get(context, key->key_persistent.Get(key->isolate));
+        v8::Local<v8::Value> Val;
+        if (MaybeValue.ToLocal(&Val))
+        {
+            return v8impl::PesapiValueFromV8LocalValue(Val);
+        }
+    }
+    return pesapi_create_undefined(env);
+}
+
+void pesapi_set_property_by_key(pesapi_env env, pesapi_value pobject, pesapi_key key, pesapi_value pvalue)
+{
+    auto context = v8impl::V8LocalContextFromPesapiEnv(env);
+    auto object = v8impl::V8LocalValueFromPesapiValue(pobject);
+    auto value = v8impl::V8LocalValueFromPesapiValue(pvalue);
+
+    if (object->IsObject())
+    {
+        auto _un_used = object.As<v8::Object>()->Set(context, key->key_persistent.Get(key->isolate), value);
+    }
+}
+
+bool pesapi_get_properties(pesapi_env env, pesapi_value pobject, size_t count, const pesapi_key keys[], pesapi_value values[])
+{
+    auto context = v8impl::V8LocalContextFromPesapiEnv(env);
+    auto object = v8impl::V8LocalValueFromPesapiValue(pobject);
+    auto isolate = context->GetIsolate();
+    auto undefined = v8::Undefined(isolate);
+    if (!object->IsObject())
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            values[i] = v8impl::PesapiValueFromV8LocalValue(undefined);
+        }
+        return false;
+    }
+    auto jsObj = object.As<v8::Object>();
+    for (size_t i = 0; i < count; ++i)
+    {
+        v8::Local<v8::Value> Val;
+        if (!jsObj->Get(context, keys[i]->key_persistent.Get(isolate)).ToLocal(&Val))
+        {
+            Val = undefined;
+        }
+        values[i] = v8impl::PesapiValueFromV8LocalValue(Val);
+    }
+    return true;
+}
+
+pesapi_value pesapi_create_array_from_buffer(pesapi_env env, pesapi_element_type element_type, const void* data, size_t count)
+{
+    auto context = v8impl::V8LocalContextFromPesapiEnv(env);
+    switch (element_type)
+    {
+        case pesapi_element_int32:
+            return v8impl::PesapiValueFromV8LocalValue(
+                v8impl::CreateArrayFromBuffer(context, static_cast<const int32_t*>(data), count));
+        case pesapi_element_uint32:
+            return v8impl::PesapiValueFromV8LocalValue(
+                v8impl::CreateArrayFromBuffer(context, static_cast<const uint32_t*>(data), count));
+        case pesapi_element_float:
+            return v8impl::PesapiValueFromV8LocalValue(
+                v8impl::CreateArrayFromBuffer(context, static_cast<const float*>(data), count));
+        case pesapi_element_double:
+            return v8impl::PesapiValueFromV8LocalValue(
+                v8impl::CreateArrayFromBuffer(context, static_cast<const double*>(data), count));
+    }
+    return pesapi_create_undefined(env);
+}
+
+size_t pesapi_get_array_elements(
+    pesapi_env env, pesapi_value parray, uint32_t start, pesapi_element_type element_type, void* out, size_t count)
+{
+    auto context = v8impl::V8LocalContextFromPesapiEnv(env);
+    auto array = v8impl::V8LocalValueFromPesapiValue(parray);
+    switch (element_type)
+    {
+        case pesapi_element_int32:
+            return v8impl::GetArrayElements(context, array, start, static_cast<int32_t*>(out), count);
+        case pesapi_element_uint32:
+            return v8impl::GetArrayElements(context, array, start, static_cast<uint32_t*>(out), count);
+        case pesapi_element_float:
+            return v8impl::GetArrayElements(context, array, start, static_cast<float*>(out), count);
+        case pesapi_element_double:
+            return v8impl::GetArrayElements(context, array, start, static_cast<double*>(out), count);
+    }
+    return 0;
+}
+
+size_t pesapi_set_array_elements(
+    pesapi_env env, pesapi_value parray, uint32_t start, pesapi_element_type element_type, const void* data, size_t count)
+{
+    auto context = v8impl::V8LocalContextFromPesapiEnv(env);
+    auto array = v8impl::V8LocalValueFromPesapiValue(parray);
+    switch (element_type)
+    {
+        case pesapi_element_int32:
+            return v8impl::SetArrayElements(context, array, start, static_cast<const int32_t*>(data), count);
+        case pesapi_element_uint32:
+            return v8impl::SetArrayElements(context, array, start, static_cast<const uint32_t*>(data), count);
+        case pesapi_element_float:
+            return v8impl::SetArrayElements(context, array, start, static_cast<const float*>(data), count);
+        case pesapi_element_double:
+            return v8impl::SetArrayElements(context, array, start, static_cast<const double*>(data), count);
+    }
+    return 0;
+}
+
 pesapi_value pesapi_get_property_uint32(pesapi_env env, pesapi_value pobject, uint32_t key)
 {
     auto context = v8impl::V8LocalContextFromPesapiEnv(env);
@@ -406,7 +406,7 @@ public:
     v8::Local<v8::Value> UEToJs(
         v8::Isolate* Isolate, v8::Local<v8::Context>& Context, const void* ValuePtr, bool PassByPointer) const override
     {
-        return FV8Utils::ToV8String(Isolate, NameProperty->GetPropertyValue(ValuePtr));
+        return FV8Utils::IsolateData<IObjectMapper>(Isolate)->NameToString(Isolate, NameProperty->GetPropertyValue(ValuePtr));
     }
 
     bool JsToUE(v8::Isolate* Isolate, v8::Local<v8::Context>& Context, const v8::Local<v8::Value>& Value, void* ValuePtr,
@@ -423,7 +423,7 @@ public:
                 return true;
             }
         }
-        NameProperty->SetPropertyValue(ValuePtr, FV8Utils::ToFName(Isolate, Value));
+        NameProperty->SetPropertyValue(ValuePtr, FV8Utils::IsolateData<IObjectMapper>(Isolate)->StringToName(Isolate, Value));
         return true;
     }
 };
@@ -668,7 +668,7 @@ public:
 
         if (!PassByPointer)
         {
-            // FScriptStructWrapper::Alloc using new, so delete in static wrapper is safe
+            // FScriptStructWrapper::Alloc uses ValueBlockPool blocks, the static wrapper finalizer releases them safely
             Ptr = FScriptStructWrapper::Alloc(StructProperty->Struct);
             StructProperty->CopySingleValue(Ptr, ValuePtr);
         }
@@ -14,8 +14,9 @@
 
 namespace PUERTS_NAMESPACE
 {
-FSourceFileWatcher::FSourceFileWatcher(std::function<void(const FString&)> InOnWatchedFileChanged)
-    : OnWatchedFileChanged(InOnWatchedFileChanged)
+FSourceFileWatcher::FSourceFileWatcher(
+    std::function<void(const FString&)> InOnWatchedFileChanged, std::function<void(const FString&)> InOnWatchedDirChanged)
+    : OnWatchedFileChanged(InOnWatchedFileChanged), OnWatchedDirChanged(InOnWatchedDirChanged)
 {
 }
 
@@ -56,6 +57,11 @@ void FSourceFileWatcher::OnDirectoryChanged(const TArray<FFileChangeData>& FileC
         return;
     for (auto Change : FileChanges)
     {
+        if (OnWatchedDirChanged && (Change.Action == FFileChangeData::FCA_Added || Change.Action == FFileChangeData::FCA_Removed))
+        {
+            OnWatchedDirChanged(Change.Filename);
+            continue;
+        }
         if (Change.Action == FFileChangeData::FCA_Modified && Change.Filename.EndsWith(TEXT(".js")))
         {
             FPaths::NormalizeFilename(Change.Filename);
@@ -10,6 +10,7 @@
 #include "V8Utils.h"
 #include "ObjectMapper.h"
 #include "PathEscape.h"
+#include "ValueTypePool.hpp"
 
 namespace PUERTS_NAMESPACE
 {
@@ -73,10 +74,64 @@ void FStructWrapper::RefreshMethod(UFunction* InFunction)
 {
     if (!InFunction->HasAnyFunctionFlags(FUNC_Static))
     {
+#ifndef WITH_QUICKJS
+        if (auto LazyFunction = LazyFunctions.Find(InFunction->GetFName()))
+        {
+            LazyFunction->Function = InFunction;
+        }
+        if (!MethodsMap.Contains(InFunction->GetFName()))
+        {
+            return;
+        }
+#endif
         GetMethodTranslator(InFunction, false);
     }
 }
 
+void FStructWrapper::SetFunction(v8::Isolate* Isolate, v8::Local<v8::Template> Target, v8::Local<v8::Value> Data,
+    const FString& Name, UFunction* InFunction, bool IsStatic, bool IsExtension, bool IsReuseTemplate)
+{
+#ifndef WITH_QUICKJS
+    LazyFunctions.Add(FName(*Name), {InFunction, IsStatic, IsExtension});
+    // already materialized by a previous template, keep it in sync with the new UFunction
+    if (IsStatic && FunctionsMap.Contains(InFunction->GetFName()))
+    {
+        GetFunctionTranslator(InFunction);
+    }
+    else if (!IsStatic && MethodsMap.Contains(InFunction->GetFName()))
+    {
+        GetMethodTranslator(InFunction, IsExtension);
+    }
+    if (!IsReuseTemplate)
+    {
+        Target->SetLazyDataProperty(FV8Utils::InternalString(Isolate, Name), MaterializeFunction, Data);
+    }
+#else
+    auto FunctionTranslator = IsStatic ? GetFunctionTranslator(InFunction) : GetMethodTranslator(InFunction, IsExtension);
+    if (!IsReuseTemplate)
+    {
+        Target->Set(FV8Utils::InternalString(Isolate, Name), FunctionTranslator->ToFunctionTemplate(Isolate));
+    }
+#endif
+}
+
+void FStructWrapper::MaterializeFunction(v8::Local<v8::Name> Property, const v8::PropertyCallbackInfo<v8::Value>& Info)
+{
+    v8::Isolate* Isolate = Info.GetIsolate();
+    v8::Local<v8::Context> Context = Isolate->GetCurrentContext();
+    FStructWrapper* This = static_cast<FStructWrapper*>(v8::Local<v8::External>::Cast(Info.Data())->Value());
+
+    auto LazyFunction = This->LazyFunctions.Find(FName(*FV8Utils::ToFString(Isolate, Property)));
+    if (!LazyFunction || !LazyFunction->Function.IsValid())
+    {
+        return;
+    }
+    UFunction* Function = LazyFunction->Function.Get();
+    auto FunctionTranslator = LazyFunction->IsStatic ? This->GetFunctionTranslator(Function)
+                                                     : This->GetMethodTranslator(Function, LazyFunction->IsExtension);
+    Info.GetReturnValue().Set(FunctionTranslator->ToFunctionTemplate(Isolate)->GetFunction(Context).ToLocalChecked());
+}
+
 MSVC_PRAGMA(warning(push))
 MSVC_PRAGMA(warning(disable : 4191))
 void FStructWrapper::InitTemplateProperties(
@@ -251,6 +306,8 @@ v8::Local<v8::FunctionTemplate> FStructWrapper::ToFunctionTemplate(v8::Isolate*
 
     InitTemplateProperties(Isolate, Struct.Get(), Result, IsReuseTemplate);
 
+    auto LazyData = v8::External::New(Isolate, this);
+
     if (const auto Class = Cast<UClass>(Struct.Get()))
     {
         for (TFieldIterator<UFunction> FuncIt(Class, EFieldIteratorFlags::ExcludeSuper); FuncIt; ++FuncIt)
@@ -265,48 +322,20 @@ v8::Local<v8::FunctionTemplate> FStructWrapper::ToFunctionTemplate(v8::Isolate*
             }
 
             FString FuncName = Function->GetName();
-            auto Key = FV8Utils::InternalString(Isolate, FuncName);
+            const bool IsStatic = Function->HasAnyFunctionFlags(FUNC_Static);
+            v8::Local<v8::Template> Target = IsStatic ? static_cast<v8::Local<v8::Template>>(Result)
+                                                      : static_cast<v8::Local<v8::Template>>(Result->PrototypeTemplate());
+
+            SetFunction(Isolate, Target, LazyData, FuncName, Function, IsStatic, false, IsReuseTemplate);
 #ifdef PUERTS_WITH_EDITOR_SUFFIX
             // 这里同时绑定带Suffix和不带Suffix的后缀是为了兼容现有的一些js写的代码(PuertsEditor)
-            v8::Local<v8::String> AdditionalKey{};
             if (puerts::IsEditorOnlyUFunction(Function))
             {
-                FString SuffixFuncName = FuncName + EditorOnlyPropertySuffix.GetData();
-                AdditionalKey = FV8Utils::InternalString(Isolate, SuffixFuncName);
-            }
-#endif
-            // 这里同时绑定带Suffix和不带Suffix的后缀是为了兼容现有的一些js写的代码(PuertsEditor)
-
-            if (Function->HasAnyFunctionFlags(FUNC_Static))
-            {
-                auto FunctionTranslator = GetFunctionTranslator(Function);
-                AddedFunctions.Add(Function->GetFName());
-                if (!IsReuseTemplate)
-                {
-                    Result->Set(Key, FunctionTranslator->ToFunctionTemplate(Isolate));
-#ifdef PUERTS_WITH_EDITOR_SUFFIX
-                    if (!AdditionalKey.IsEmpty())
-                    {
-                        Result->Set(AdditionalKey, FunctionTranslator->ToFunctionTemplate(Isolate));
-                    }
-#endif
-                }
+                SetFunction(Isolate, Target, LazyData, FuncName + EditorOnlyPropertySuffix.GetData(), Function, IsStatic, false,
+                    IsReuseTemplate);
             }
-            else
-            {
-                auto FunctionTranslator = GetMethodTranslator(Function, false);
-                AddedMethods.Add(Function->GetFName());
-                if (!IsReuseTemplate)
-                {
-                    Result->PrototypeTemplate()->Set(Key, FunctionTranslator->ToFunctionTemplate(Isolate));
-#ifdef PUERTS_WITH_EDITOR_SUFFIX
-                    if (!AdditionalKey.IsEmpty())
-                    {
-                        Result->PrototypeTemplate()->Set(AdditionalKey, FunctionTranslator->ToFunctionTemplate(Isolate));
-                    }
 #endif
-                }
-            }
+            (IsStatic ? AddedFunctions : AddedMethods).Add(Function->GetFName());
         }
 
         for (const FImplementedInterface& Interface : Class->Interfaces)
@@ -319,11 +348,9 @@ v8::Local<v8::FunctionTemplate> FStructWrapper::ToFunctionTemplate(v8::Isolate*
                     UFunction* ItfFunction = *ItfFuncIt;
                     if (!ItfFunction->HasAnyFunctionFlags(FUNC_Static) && !AddedMethods.Contains(ItfFunction->GetFName()))
                     {
-                        auto ItfFunctionTranslator = GetMethodTranslator(ItfFunction, false);
+                        SetFunction(Isolate, Result->PrototypeTemplate(), LazyData, ItfFunction->GetName(), ItfFunction, false,
+                            false, IsReuseTemplate);
                         AddedMethods.Add(ItfFunction->GetFName());
-                        if (!IsReuseTemplate)
-                            Result->PrototypeTemplate()->Set(FV8Utils::InternalString(Isolate, ItfFunction->GetName()),
-                                ItfFunctionTranslator->ToFunctionTemplate(Isolate));
                     }
                 }
             }
@@ -346,14 +373,9 @@ v8::Local<v8::FunctionTemplate> FStructWrapper::ToFunctionTemplate(v8::Isolate*
             continue;
         }
 
-        auto FunctionTranslator = GetMethodTranslator(Function, true);
+        SetFunction(Isolate, Result->PrototypeTemplate(), LazyData, Function->GetName(), Function, false, true, IsReuseTemplate);
 
         AddedMethods.Add(Function->GetFName());
-        if (!IsReuseTemplate)
-        {
-            auto Key = FV8Utils::InternalString(Isolate, Function->GetName());
-            Result->PrototypeTemplate()->Set(Key, FunctionTranslator->ToFunctionTemplate(Isolate));
-        }
     }
 
     if (!IsReuseTemplate)
@@ -630,7 +652,7 @@ void FScriptStructWrapper::New(
 
 void* FScriptStructWrapper::Alloc(UScriptStruct* InScriptStruct)
 {
-    void* ScriptStructMemory = new char[InScriptStruct->GetStructureSize()];
+    void* ScriptStructMemory = ValueBlockPool::Alloc(InScriptStruct->GetStructureSize());
     InScriptStruct->InitializeStruct(ScriptStructMemory);
     return ScriptStructMemory;
 }
@@ -643,9 +665,13 @@ void FScriptStructWrapper::Free(TWeakObjectPtr<UStruct> InStruct, pesapi_finaliz
     }
     else
     {
+        size_t Size = 0;
         if (InStruct.IsValid())
+        {
             InStruct->DestroyStruct(Ptr);
-        delete[] static_cast<char*>(Ptr);
+            Size = InStruct->GetStructureSize();
+        }
+        ValueBlockPool::Free(Ptr, Size);
     }
 }
 
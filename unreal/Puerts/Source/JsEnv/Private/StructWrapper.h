@@ -68,6 +68,21 @@ protected:
 
     void RefreshMethod(UFunction* InFunction);
 
+    // UFunctions bound by name, the translator is only created when js first reads the member
+    struct FLazyFunction
+    {
+        TWeakObjectPtr<UFunction> Function;
+        bool IsStatic;
+        bool IsExtension;
+    };
+
+    TMap<FName, FLazyFunction> LazyFunctions;
+
+    void SetFunction(v8::Isolate* Isolate, v8::Local<v8::Template> Target, v8::Local<v8::Value> Data, const FString& Name,
+        UFunction* InFunction, bool IsStatic, bool IsExtension, bool IsReuseTemplate);
+
+    static void MaterializeFunction(v8::Local<v8::Name> Property, const v8::PropertyCallbackInfo<v8::Value>& Info);
+
     void InitTemplateProperties(
         v8::Isolate* Isolate, UStruct* InStruct, v8::Local<v8::FunctionTemplate> Template, bool IsReuseTemplate);
 
@@ -0,0 +1,130 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PuertsNamespaceDef.h"
+
+namespace PUERTS_NAMESPACE
+{
+// Hierarchical timing wheel in millisecond ticks, 4 levels of 64 slots cover about 4.6 hours, longer
+// timers are parked in the last level and cascade down again when they come around.
+// Cancel is lazy: the owner forgets its record and skips entries it no longer knows when they come due,
+// so both insert and cancel are O(1).
+class FTimerWheel
+{
+public:
+    struct FEntry
+    {
+        uint32 Id;
+        uint64 Expire;
+    };
+
+    void Reset(uint64 Now)
+    {
+        for (int32 Level = 0; Level < LevelCount; ++Level)
+        {
+            for (int32 Index = 0; Index < SlotCount; ++Index)
+            {
+                Slots[Level][Index].Empty();
+            }
+        }
+        Current = Now;
+        Num = 0;
+    }
+
+    // returns the expiry actually stored, which is what Advance reports, keep it to match the entry when it comes due
+    uint64 Add(uint32 Id, uint64 Expire)
+    {
+        // never into the slot being processed, it would wait a whole revolution
+        const uint64 Stored = Expire <= Current ? Current + 1 : Expire;
+        Place(FEntry{Id, Stored});
+        ++Num;
+        return Stored;
+    }
+
+    // move the wheel to Now, every entry that came due is appended to OutDue in expiry order
+    void Advance(uint64 Now, TArray<FEntry>& OutDue)
+    {
+        while (Current < Now)
+        {
+            if (Num == 0)
+            {
+                Current = Now;
+                break;
+            }
+            ++Current;
+            const uint32 Index = Current & SlotMask;
+            if (Index == 0)
+            {
+                for (int32 Level = 1; Level < LevelCount; ++Level)
+                {
+                    const uint32 LevelIndex = (Current >> (Level * SlotBits)) & SlotMask;
+                    Cascade(Level, LevelIndex);
+                    if (LevelIndex != 0)
+                    {
+                        break;
+                    }
+                }
+            }
+            TArray<FEntry>& Slot = Slots[0][Index];
+            if (Slot.Num() > 0)
+            {
+                OutDue.Append(Slot);
+                Num -= Slot.Num();
+                Slot.Reset();
+            }
+        }
+    }
+
+    // entries still in the wheel, including the lazily cancelled ones
+    int32 GetNum() const
+    {
+        return Num;
+    }
+
+private:
+    static constexpr int32 SlotBits = 6;
+    static constexpr int32 SlotCount = 1 << SlotBits;
+    static constexpr uint32 SlotMask = SlotCount - 1;
+    static constexpr int32 LevelCount = 4;
+
+    void Place(const FEntry& Entry)
+    {
+        const uint64 Expire = Entry.Expire < Current ? Current : Entry.Expire;
+        const uint64 Delta = Expire - Current;
+        for (int32 Level = 0; Level < LevelCount; ++Level)
+        {
+            if (Delta < (1ull << ((Level + 1) * SlotBits)))
+            {
+                Slots[Level][(Expire >> (Level * SlotBits)) & SlotMask].Add(Entry);
+                return;
+            }
+        }
+        const uint64 Parked = Current + (1ull << (LevelCount * SlotBits)) - 1;
+        Slots[LevelCount - 1][(Parked >> ((LevelCount - 1) * SlotBits)) & SlotMask].Add(Entry);
+    }
+
+    void Cascade(int32 Level, uint32 Index)
+    {
+        TArray<FEntry> Entries = MoveTemp(Slots[Level][Index]);
+        Slots[Level][Index].Reset();
+        for (const FEntry& Entry : Entries)
+        {
+            Place(Entry);
+        }
+    }
+
+    TArray<FEntry> Slots[LevelCount][SlotCount];
+
+    uint64 Current = 0;
+
+    int32 Num = 0;
+};
+}    // namespace PUERTS_NAMESPACE
@@ -1,5 +1,32 @@
 #include <V8Utils.h>
 
+#if !defined(WITH_QUICKJS) && !PLATFORM_TCHAR_IS_4_BYTES
+namespace
+{
+// owns the characters of an external string, v8 deletes it through Dispose
+class FExternalFStringResource : public v8::String::ExternalStringResource
+{
+public:
+    explicit FExternalFStringResource(FString&& InString) : String(MoveTemp(InString))
+    {
+    }
+
+    const uint16_t* data() const override
+    {
+        return reinterpret_cast<const uint16_t*>(*String);
+    }
+
+    size_t length() const override
+    {
+        return String.Len();
+    }
+
+private:
+    FString String;
+};
+}    // namespace
+#endif
+
 v8::Local<v8::String> puerts::FV8Utils::ToV8String(v8::Isolate* Isolate, const TCHAR* String)
 {
 #ifdef WITH_QUICKJS
@@ -9,11 +36,45 @@ v8::Local<v8::String> puerts::FV8Utils::ToV8String(v8::Isolate* Isolate, const T
 #endif
 }
 
+v8::Local<v8::String> puerts::FV8Utils::ToExternalV8String(v8::Isolate* Isolate, FString&& String)
+{
+#if defined(WITH_QUICKJS) || PLATFORM_TCHAR_IS_4_BYTES
+    return ToV8String(Isolate, *String);
+#else
+    auto Resource = new FExternalFStringResource(MoveTemp(String));
+    v8::Local<v8::String> Result;
+    if (!v8::String::NewExternalTwoByte(Isolate, Resource).ToLocal(&Result))
+    {
+        // rejected (longer than v8::String::kMaxLength), the resource is still ours
+        delete Resource;
+        return v8::String::Empty(Isolate);
+    }
+    return Result;
+#endif
+}
+
 FString puerts::FV8Utils::ToFString(v8::Isolate* Isolate, v8::Local<v8::Value> Value)
 {
 #ifdef WITH_QUICKJS
     return UTF8_TO_TCHAR(*(v8::String::Utf8Value(Isolate, Value)));
 #else
+#if !PLATFORM_TCHAR_IS_4_BYTES
+    if (Value->IsString())
+    {
+        // written straight into the FString storage, no intermediate v8::String::Value buffer
+        auto String = Value.As<v8::String>();
+        const int Length = String->Length();
+        FString Result;
+        if (Length > 0)
+        {
+            TArray<TCHAR>& CharArray = Result.GetCharArray();
+            CharArray.SetNumUninitialized(Length + 1);
+            String->Write(Isolate, reinterpret_cast<uint16_t*>(CharArray.GetData()), 0, Length, v8::String::NO_NULL_TERMINATION);
+            CharArray[Length] = TEXT('\0');
+        }
+        return Result;
+    }
+#endif
     return UTF16_TO_TCHAR(*(v8::String::Value(Isolate, Value)));
 #endif
 }
\ No newline at end of file
@@ -23,6 +23,11 @@ public:
 
     virtual FString& GetScriptRoot() = 0;
 
+    // called when files were added or removed under the watched source dirs
+    virtual void InvalidateSearchCache()
+    {
+    }
+
     virtual ~IJSModuleLoader()
     {
     }
@@ -47,7 +52,43 @@ public:
 
     virtual bool SearchModuleWithExtInDir(const FString& Dir, const FString& RequiredModule, FString& Path, FString& AbsolutePath);
 
+    virtual void InvalidateSearchCache() override;
+
+    // optional list of every script file (one path relative to the Content dir per line), once loaded
+    // CheckExists answers from it instead of touching the file system
+    bool LoadManifest(const FString& ManifestPath);
+
+    // only call with true when InvalidateSearchCache is wired to a file watcher (FSourceFileWatcher),
+    // otherwise a script added after a failed lookup would never be found
+    void SetCacheMisses(bool bInCacheMisses);
+
     FString ScriptRoot;
+
+private:
+    bool SearchUncached(const FString& RequiredDir, const FString& RequiredModule, FString& Path, FString& AbsolutePath);
+
+    bool FileExists(const FString& NormalizedPath);
+
+    struct FSearchResult
+    {
+        FString Path;
+        FString AbsolutePath;
+    };
+
+    // (RequiredDir, RequiredModule) -> resolved paths, failed searches are not cached
+    TMap<FString, FSearchResult> SearchCache;
+
+    // result of every probed path, misses only when bCacheMisses is set. Hits stay until InvalidateSearchCache,
+    // which a failed Load also calls, so a deleted script is searched again
+    TMap<FString, bool> ExistsCache;
+
+    TSet<FString> Manifest;
+
+    bool bUseManifest = false;
+
+    bool bCacheMisses = false;
+
+    FCriticalSection CacheCritical;
 };
 
 }    // namespace PUERTS_NAMESPACE
@@ -96,6 +96,11 @@ public:
 
     void InitExtensionMethodsMap();
 
+    // a native UFunction is only called through a v8 fast call (WITH_V8_FAST_CALL) once opted in by its path name,
+    // e.g. TEXT("/Script/Engine.KismetMathLibrary:Add_IntInt"), it must never run js or allocate on the v8 heap.
+    // Same in editor and cooked builds, has to happen before the function is first used from js
+    static void AllowUFunctionFastCall(FName FunctionPath);
+
 private:
     std::unique_ptr<IJsEnv> GameScript;
 };
@@ -15,6 +15,7 @@
 #include <vector>
 #include "pesapi.h"
 #include "TypeInfo.hpp"
+#include "ValueTypePool.hpp"
 
 #define __DefObjectType_pesapi_impl(CLS)              \
     namespace PUERTS_NAMESPACE                        \
@@ -59,7 +60,8 @@
     {                                                                                                         \
         static pesapi_value toScript(pesapi_env env, CLS value)                                               \
         {                                                                                                     \
-            return pesapi_native_object_to_value(env, DynamicTypeId<CLS>::get(&value), new CLS(value), true); \
+            return pesapi_native_object_to_value(                                                             \
+                env, DynamicTypeId<CLS>::get(&value), ValueTypeAllocator<CLS>::Copy(value), true);            \
         }                                                                                                     \
         static CLS toCpp(pesapi_env env, pesapi_value value)                                                  \
         {                                                                                                     \
@@ -584,7 +586,7 @@ struct Converter<T, typename std::enable_if<std::is_copy_constructible<T>::value
 {
     static pesapi_value toScript(pesapi_env env, T value)
     {
-        return pesapi_native_object_to_value(env, DynamicTypeId<T>::get(&value), new T(value), true);
+        return pesapi_native_object_to_value(env, DynamicTypeId<T>::get(&value), ValueTypeAllocator<T>::Copy(value), true);
     }
     static T toCpp(pesapi_env env, pesapi_value value)
     {
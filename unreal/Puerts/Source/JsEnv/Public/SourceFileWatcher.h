@@ -19,7 +19,8 @@ namespace PUERTS_NAMESPACE
 class JSENV_API FSourceFileWatcher
 {
 public:
-    FSourceFileWatcher(std::function<void(const FString&)> InOnWatchedFileChanged);
+    FSourceFileWatcher(std::function<void(const FString&)> InOnWatchedFileChanged,
+        std::function<void(const FString&)> InOnWatchedDirChanged = nullptr);
 
     ~FSourceFileWatcher();
 
@@ -35,6 +36,9 @@ private:
     FCriticalSection SourceFileWatcherCritical;
 
     std::function<void(const FString&)> OnWatchedFileChanged;
+
+    // a file was added to or removed from a watched dir
+    std::function<void(const FString&)> OnWatchedDirChanged;
 };
 }    // namespace PUERTS_NAMESPACE
 #endif
\ No newline at end of file
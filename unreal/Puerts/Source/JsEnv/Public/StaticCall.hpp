@@ -8,10 +8,12 @@
 
 #pragma once
 
+#include <string>
 #include <tuple>
 #include <type_traits>
 #include <vector>
 #include "TypeInfo.hpp"
+#include "ValueTypePool.hpp"
 #include <type_traits>
 #if defined(WITH_THROW_IN_CPP) && !defined(THREAD_LOCAL_IMPL_THROW)
 #include <exception>
@@ -955,6 +957,119 @@ public:
     }
 };
 
+// coarse kind of a script value, taken once per argument so that overloads which can not accept it are skipped
+// without running their converters
+enum ArgumentKind : unsigned int
+{
+    ArgumentKindNumber = 1,
+    ArgumentKindBoolean = 2,
+    ArgumentKindString = 4,
+    ArgumentKindBigInt = 8,
+    ArgumentKindOther = 16,
+    ArgumentKindAny = 31
+};
+
+template <typename API>
+inline unsigned int GetArgumentKind(typename API::ContextType context, typename API::ValueType value)
+{
+    // a value has only one typeof, so the first converter accepting it decides
+    if (API::template Converter<double>::accept(context, value))
+        return ArgumentKindNumber;
+    if (API::template Converter<bool>::accept(context, value))
+        return ArgumentKindBoolean;
+    if (API::template Converter<const char*>::accept(context, value))
+        return ArgumentKindString;
+    if (API::template Converter<int64_t>::accept(context, value))
+        return ArgumentKindBigInt;
+    return ArgumentKindOther;
+}
+
+// kinds a converter may accept, only primitives are narrowed, anything else (objects, refs, user converters) may accept all
+template <typename T, typename = void>
+struct ArgumentKindMask
+{
+    static constexpr unsigned int value = ArgumentKindAny;
+};
+
+template <typename T>
+struct ArgumentKindMask<T, typename std::enable_if<std::is_same<T, bool>::value>::type>
+{
+    static constexpr unsigned int value = ArgumentKindBoolean;
+};
+
+template <typename T>
+struct ArgumentKindMask<T, typename std::enable_if<(std::is_integral<T>::value && !std::is_same<T, bool>::value && sizeof(T) < 8) ||
+                                                   std::is_enum<T>::value || std::is_floating_point<T>::value>::type>
+{
+    static constexpr unsigned int value = ArgumentKindNumber;
+};
+
+template <typename T>
+struct ArgumentKindMask<T, typename std::enable_if<std::is_integral<T>::value && sizeof(T) == 8>::type>
+{
+    static constexpr unsigned int value = ArgumentKindBigInt;
+};
+
+template <typename T>
+struct ArgumentKindMask<T,
+    typename std::enable_if<std::is_same<T, std::string>::value || std::is_same<T, const char*>::value>::type>
+{
+    static constexpr unsigned int value = ArgumentKindString;
+};
+
+// compile time signature of an overload, MayAccept is a conservative prefilter of ArgumentsChecker:
+// false means overloadCall would reject the arguments, true means it has to be tried
+template <typename... Args>
+struct OverloadSignature
+{
+    static constexpr int ArgsLength = sizeof...(Args);
+
+    static bool MayAccept(int argsLen, const unsigned int* kinds)
+    {
+        if (argsLen != ArgsLength)
+            return false;
+        const unsigned int masks[] = {ArgumentKindMask<typename ConverterDecay<Args>::type>::value..., 0u};
+        for (int i = 0; i < ArgsLength; ++i)
+        {
+            if (!(masks[i] & kinds[i]))
+                return false;
+        }
+        return true;
+    }
+};
+
+// overloads without a signature (DeclOverload, hand written wraps) are always tried
+template <typename Wrap, typename = void>
+struct OverloadFilter
+{
+    static constexpr int ArgsLength = 0;
+
+    static bool MayAccept(int argsLen, const unsigned int* kinds)
+    {
+        return true;
+    }
+};
+
+template <typename Wrap>
+struct OverloadFilter<Wrap, Void_t<typename Wrap::Signature>> : Wrap::Signature
+{
+};
+
+template <int... Values>
+struct MaxOf;
+
+template <>
+struct MaxOf<>
+{
+    static constexpr int value = 0;
+};
+
+template <int First, int... Rest>
+struct MaxOf<First, Rest...>
+{
+    static constexpr int value = First > MaxOf<Rest...>::value ? First : MaxOf<Rest...>::value;
+};
+
 }    // namespace internal
 
 template <typename API, typename T, T, bool ReturnByPointer = false, bool ScriptTypePtrAsRef = true, bool GetSelfFromData = false>
@@ -964,6 +1079,8 @@ template <typename API, typename Ret, typename... Args, Ret (*func)(Args...), bo
     bool GetSelfFromData>
 struct FuncCallWrapper<API, Ret (*)(Args...), func, ReturnByPointer, ScriptTypePtrAsRef, GetSelfFromData>
 {
+    using Signature = internal::OverloadSignature<Args...>;
+
     static void call(typename API::CallbackInfoType info)
     {
         using Helper = internal::FuncCallHelper<API, std::pair<Ret, std::tuple<Args...>>, false, ReturnByPointer,
@@ -1031,6 +1148,8 @@ template <typename API, typename Inc, typename Ret, typename... Args, Ret (Inc::
     bool ScriptTypePtrAsRef, bool GetSelfFromData>
 struct FuncCallWrapper<API, Ret (Inc::*)(Args...), func, ReturnByPointer, ScriptTypePtrAsRef, GetSelfFromData>
 {
+    using Signature = internal::OverloadSignature<Args...>;
+
     static void call(typename API::CallbackInfoType info)
     {
         using Helper = internal::FuncCallHelper<API, std::pair<Ret, std::tuple<Args...>>, false, ReturnByPointer,
@@ -1078,6 +1197,8 @@ template <typename API, typename Inc, typename Ret, typename... Args, Ret (Inc::
     bool ScriptTypePtrAsRef, bool GetSelfFromData>
 struct FuncCallWrapper<API, Ret (Inc::*)(Args...) const, func, ReturnByPointer, ScriptTypePtrAsRef, GetSelfFromData>
 {
+    using Signature = internal::OverloadSignature<Args...>;
+
     static void call(typename API::CallbackInfoType info)
     {
         using Helper = internal::FuncCallHelper<API, std::pair<Ret, std::tuple<Args...>>, false, ReturnByPointer,
@@ -1289,40 +1410,47 @@ struct ConstructorsCombiner
 template <typename API, typename... OverloadWraps>
 struct OverloadsCombiner
 {
-    typedef bool (*V8FunctionCallbackWithBoolRet)(typename API::CallbackInfoType info);
-
-    template <V8FunctionCallbackWithBoolRet Func, V8FunctionCallbackWithBoolRet... Rest>
+    // overloads are still tried in declaration order, the prefilter only skips those that would reject the arguments
+    template <typename Wrap, typename... Rest>
     struct OverloadsRecursion
     {
-        static bool _call(typename API::CallbackInfoType info)
+        static bool _call(typename API::CallbackInfoType info, int argsLen, const unsigned int* kinds)
         {
-            if (Func(info))
+            if (internal::OverloadFilter<Wrap>::MayAccept(argsLen, kinds) && Wrap::overloadCall(info))
                 return true;
             else
-                return OverloadsRecursion<Rest...>::_call(info);
-        }
-
-        static void call(typename API::CallbackInfoType info)
-        {
-            if (!_call(info))
-            {
-                API::ThrowException(info, "invalid parameter!");
-            }
+                return OverloadsRecursion<Rest...>::_call(info, argsLen, kinds);
         }
     };
 
-    template <V8FunctionCallbackWithBoolRet Func>
-    struct OverloadsRecursion<Func>
+    template <typename Wrap>
+    struct OverloadsRecursion<Wrap>
     {
-        static bool _call(typename API::CallbackInfoType info)
+        static bool _call(typename API::CallbackInfoType info, int argsLen, const unsigned int* kinds)
         {
-            return Func(info);
+            return internal::OverloadFilter<Wrap>::MayAccept(argsLen, kinds) && Wrap::overloadCall(info);
         }
     };
 
+    static constexpr int MaxArgsLength = internal::MaxOf<internal::OverloadFilter<OverloadWraps>::ArgsLength...>::value;
+
     static void call(typename API::CallbackInfoType info)
     {
-        OverloadsRecursion<(&OverloadWraps::overloadCall)...>::call(info);
+        const int argsLen = API::GetArgsLen(info);
+        // with more arguments than any signature every filter rejects by length before looking at kinds
+        unsigned int kinds[MaxArgsLength + 1];
+        if (argsLen <= MaxArgsLength)
+        {
+            auto context = API::GetContext(info);
+            for (int i = 0; i < argsLen; ++i)
+            {
+                kinds[i] = internal::GetArgumentKind<API>(context, API::GetArg(info, i));
+            }
+        }
+        if (!OverloadsRecursion<OverloadWraps...>::_call(info, argsLen, kinds))
+        {
+            API::ThrowException(info, "invalid parameter!");
+        }
     }
 
     static constexpr int length = sizeof...(OverloadWraps);
@@ -1824,7 +1952,7 @@ public:
     {
         static FinalizeFuncType Build()
         {
-            return [](void* Ptr, void* ClassData, void* EnvData) { delete static_cast<FC*>(Ptr); };
+            return [](void* Ptr, void* ClassData, void* EnvData) { ValueTypeAllocator<FC>::Delete(Ptr); };
         }
     };
 
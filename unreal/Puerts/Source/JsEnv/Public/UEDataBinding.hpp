@@ -12,6 +12,7 @@
 #include "DataTransfer.h"
 #include "ArrayBuffer.h"
 #include "UECompatible.h"
+#include "ValueTypePool.hpp"
 #include "PuertsNamespaceDef.h"
 
 #define UsingUClass(CLS)                             \
@@ -521,7 +522,9 @@ struct Converter<T, typename std::enable_if<internal::IsUStructHelper<T>::value>
 {
     static v8::Local<v8::Value> toScript(v8::Local<v8::Context> context, const T value)
     {
-        return DataTransfer::FindOrAddStruct<T>(context->GetIsolate(), context, new T(value), false);
+        // same storage as FScriptStructWrapper::Alloc, released to the pool by the struct finalizer
+        return DataTransfer::FindOrAddStruct<T>(
+            context->GetIsolate(), context, new (ValueTypePool<T>::Alloc()) T(value), false);
     }
 
     static T toCpp(v8::Local<v8::Context> context, const v8::Local<v8::Value>& value)
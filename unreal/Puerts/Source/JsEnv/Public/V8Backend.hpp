@@ -13,6 +13,7 @@
 #include <functional>
 #include "DataTransfer.h"
 #include "JSClassRegister.h"
+#include "ValueTypePool.hpp"
 
 #define __DefObjectType_v8_impl(CLS)                  \
     namespace PUERTS_NAMESPACE                        \
@@ -59,7 +60,8 @@
         static v8::Local<v8::Value> toScript(v8::Local<v8::Context> context, CLS value)                                    \
         {                                                                                                                  \
             return ::PUERTS_NAMESPACE::DataTransfer::FindOrAddCData(                                                       \
-                context->GetIsolate(), context, DynamicTypeId<CLS>::get(&value), new CLS(value), false);                   \
+                context->GetIsolate(), context, DynamicTypeId<CLS>::get(&value),                                           \
+                ::PUERTS_NAMESPACE::ValueTypeAllocator<CLS>::Copy(value), false);                                          \
         }                                                                                                                  \
         static CLS toCpp(v8::Local<v8::Context> context, const v8::Local<v8::Value>& value)                                \
         {                                                                                                                  \
@@ -631,7 +633,8 @@ struct Converter<T, typename std::enable_if<std::is_copy_constructible<T>::value
 {
     static v8::Local<v8::Value> toScript(v8::Local<v8::Context> context, T value)
     {
-        return DataTransfer::FindOrAddCData(context->GetIsolate(), context, DynamicTypeId<T>::get(&value), new T(value), false);
+        return DataTransfer::FindOrAddCData(
+            context->GetIsolate(), context, DynamicTypeId<T>::get(&value), ValueTypeAllocator<T>::Copy(value), false);
     }
     static T toCpp(v8::Local<v8::Context> context, const v8::Local<v8::Value>& value)
     {
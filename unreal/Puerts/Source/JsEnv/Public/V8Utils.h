@@ -16,6 +16,10 @@
 #include "DataTransfer.h"
 #include "UECompatible.h"
 
+#ifndef PUERTS_EXTERNAL_STRING_THRESHOLD
+#define PUERTS_EXTERNAL_STRING_THRESHOLD 0
+#endif
+
 namespace PUERTS_NAMESPACE
 {
 enum ArgType
@@ -107,11 +111,38 @@ public:
 
     FORCEINLINE static v8::Local<v8::String> ToV8String(v8::Isolate* Isolate, const FString& String)
     {
+#if PUERTS_EXTERNAL_STRING_THRESHOLD > 0
+        if (String.Len() >= PUERTS_EXTERNAL_STRING_THRESHOLD)
+        {
+            return ToExternalV8String(Isolate, FString(String));
+        }
+#endif
         // return ToV8String(Isolate, TCHAR_TO_UTF8(*String));
         return ToV8String(Isolate, *String);
     }
 
+    // a large temporary hands its buffer to the external string instead of being copied again
+    FORCEINLINE static v8::Local<v8::String> ToV8String(v8::Isolate* Isolate, FString&& String)
+    {
+#if PUERTS_EXTERNAL_STRING_THRESHOLD > 0
+        if (String.Len() >= PUERTS_EXTERNAL_STRING_THRESHOLD)
+        {
+            return ToExternalV8String(Isolate, MoveTemp(String));
+        }
+#endif
+        return ToV8String(Isolate, *String);
+    }
+
+    // the string keeps living outside the v8 heap, v8 frees it when the js string is collected
+    static v8::Local<v8::String> ToExternalV8String(v8::Isolate* Isolate, FString&& String);
+
     FORCEINLINE static v8::Local<v8::String> ToV8String(v8::Isolate* Isolate, const FName& String)
+    {
+        return ToV8String(Isolate, NameToString(String));
+    }
+
+    // built from the comparison entry, two names are equal iff their strings are
+    FORCEINLINE static FString NameToString(const FName& String)
     {
         const FNameEntry* Entry = String.GetComparisonNameEntry();
         FString Out;
@@ -129,7 +160,7 @@ public:
             Out.AppendInt(NAME_INTERNAL_TO_EXTERNAL(String.GetNumber()));
         }
 
-        return ToV8String(Isolate, Out);
+        return Out;
     }
 
     FORCEINLINE static v8::Local<v8::String> ToV8String(v8::Isolate* Isolate, const FText& String)
@@ -0,0 +1,162 @@
+/*
+ * Tencent is pleased to support the open source community by making Puerts available.
+ * Copyright (C) 2020 THL A29 Limited, a Tencent company.  All rights reserved.
+ * Puerts is licensed under the BSD 3-Clause License, except for the third-party components listed in the file 'LICENSE' which may
+ * be subject to their corresponding license terms. This file is subject to the terms and conditions defined in file 'LICENSE',
+ * which is part of this source code package.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <vector>
+#include "PuertsNamespaceDef.h"
+
+namespace PUERTS_NAMESPACE
+{
+namespace internal
+{
+template <typename T, typename = void>
+struct HasClassOperatorNew : std::false_type
+{
+};
+
+template <typename T>
+struct HasClassOperatorNew<T, decltype((void) &T::operator new)> : std::true_type
+{
+};
+}    // namespace internal
+
+// small trivially copyable value types (vectors, colors...) returned by value are boxed for every call,
+// those are recycled instead of going through new/delete each time
+template <typename T, typename = void>
+struct is_pooled_value_type : std::false_type
+{
+};
+
+template <typename T>
+struct is_pooled_value_type<T, typename std::enable_if<std::is_trivially_copyable<T>::value &&
+                                                       std::is_trivially_destructible<T>::value && sizeof(T) <= 128 &&
+                                                       alignof(T) <= alignof(std::max_align_t) &&
+                                                       !internal::HasClassOperatorNew<T>::value>::type> : std::true_type
+{
+};
+
+// Per thread free lists of ::operator new blocks, one per exact size up to MaxPooledSize. A block goes back to the
+// list of the size it was allocated with, so a typed allocation (ValueTypePool<FVector>, `new FVector`) and a
+// reflected one (FScriptStructWrapper::Alloc, sized by the UScriptStruct) release to the same list.
+// Finalizers run on the thread of the isolate that owns the object, a thread_local list needs no lock; the rare
+// block freed on another thread (a backing store released by a v8 worker) just joins that thread's list.
+class ValueBlockPool
+{
+public:
+    static constexpr size_t MaxPooledSize = 128;
+
+    static void* Alloc(size_t Size)
+    {
+        if (Size == 0 || Size > MaxPooledSize)
+        {
+            return ::operator new(Size);
+        }
+        auto& Blocks = GetFreeLists().Blocks[Size - 1];
+        if (Blocks.empty())
+        {
+            return ::operator new(Size);
+        }
+        void* Ptr = Blocks.back();
+        Blocks.pop_back();
+        return Ptr;
+    }
+
+    // Size 0 if unknown (the struct has been unloaded), the block is just deleted
+    static void Free(void* Ptr, size_t Size)
+    {
+        if (Size == 0 || Size > MaxPooledSize)
+        {
+            ::operator delete(Ptr);
+            return;
+        }
+        auto& Blocks = GetFreeLists().Blocks[Size - 1];
+        if (Blocks.size() < MaxCached)
+        {
+            Blocks.push_back(Ptr);
+        }
+        else
+        {
+            ::operator delete(Ptr);
+        }
+    }
+
+private:
+    static constexpr size_t MaxCached = 1024;
+
+    struct FreeLists
+    {
+        std::vector<void*> Blocks[MaxPooledSize];
+
+        ~FreeLists()
+        {
+            for (auto& List : Blocks)
+            {
+                for (auto Ptr : List)
+                {
+                    ::operator delete(Ptr);
+                }
+            }
+        }
+    };
+
+    static FreeLists& GetFreeLists()
+    {
+        static thread_local FreeLists Lists;
+        return Lists;
+    }
+};
+
+// blocks of sizeof(T), a block allocated by `new T` (e.g. a js constructor call) can be recycled here too
+template <typename T>
+class ValueTypePool
+{
+public:
+    static void* Alloc()
+    {
+        return ValueBlockPool::Alloc(sizeof(T));
+    }
+
+    static void Free(void* Ptr)
+    {
+        ValueBlockPool::Free(Ptr, sizeof(T));
+    }
+};
+
+// boxes a copy of a value type for script side ownership, Delete is the matching finalizer
+template <typename T, typename = void>
+struct ValueTypeAllocator
+{
+    static T* Copy(const T& Value)
+    {
+        return new T(Value);
+    }
+
+    static void Delete(void* Ptr)
+    {
+        delete static_cast<T*>(Ptr);
+    }
+};
+
+template <typename T>
+struct ValueTypeAllocator<T, typename std::enable_if<is_pooled_value_type<T>::value>::type>
+{
+    static T* Copy(const T& Value)
+    {
+        return new (ValueTypePool<T>::Alloc()) T(Value);
+    }
+
+    static void Delete(void* Ptr)
+    {
+        ValueTypePool<T>::Free(Ptr);
+    }
+};
+}    // namespace PUERTS_NAMESPACE
@@ -123,6 +123,15 @@ typedef struct pesapi_scope__* pesapi_scope;
 typedef struct pesapi_type_info__* pesapi_type_info;
 typedef struct pesapi_signature_info__* pesapi_signature_info;
 typedef struct pesapi_property_descriptor__* pesapi_property_descriptor;
+typedef struct pesapi_key__* pesapi_key;
+
+typedef enum pesapi_element_type
+{
+    pesapi_element_int32,
+    pesapi_element_uint32,
+    pesapi_element_float,
+    pesapi_element_double
+} pesapi_element_type;
 
 typedef void (*pesapi_callback)(pesapi_callback_info info);
 typedef void* (*pesapi_constructor)(pesapi_callback_info info);
@@ -210,6 +219,11 @@ PESAPI_EXTERN bool pesapi_has_caught(pesapi_scope scope);
 PESAPI_EXTERN const char* pesapi_get_exception_as_string(pesapi_scope scope, bool with_stack);
 PESAPI_EXTERN void pesapi_close_scope(pesapi_scope scope);
 PESAPI_EXTERN void pesapi_close_scope_placement(pesapi_scope scope);
+// keep the isolate and context of env_ref entered until the matching pesapi_end_batch, scopes opened in between
+// on the same env skip entering them while that context is still the current one. Batches nest on one env, return false
+// if another env is batching on this thread. Destroying the env ends a batch its thread left open.
+PESAPI_EXTERN bool pesapi_begin_batch(pesapi_env_ref env_ref);
+PESAPI_EXTERN void pesapi_end_batch(pesapi_env_ref env_ref);
 
 PESAPI_EXTERN pesapi_value_ref pesapi_create_value_ref(pesapi_env env, pesapi_value value, uint32_t internal_field_count);
 PESAPI_EXTERN pesapi_value_ref pesapi_duplicate_value_ref(pesapi_value_ref value_ref);
@@ -230,6 +244,24 @@ PESAPI_EXTERN bool pesapi_set_private(pesapi_env env, pesapi_value object, void*
 PESAPI_EXTERN pesapi_value pesapi_get_property_uint32(pesapi_env env, pesapi_value object, uint32_t key);
 PESAPI_EXTERN void pesapi_set_property_uint32(pesapi_env env, pesapi_value object, uint32_t key, pesapi_value value);
 
+// interned property name, create once and reuse it to skip the utf8 decode and hash of every access
+PESAPI_EXTERN pesapi_key pesapi_create_key(pesapi_env env, const char* key);
+PESAPI_EXTERN void pesapi_release_key(pesapi_key key);
+PESAPI_EXTERN pesapi_value pesapi_get_property_by_key(pesapi_env env, pesapi_value object, pesapi_key key);
+PESAPI_EXTERN void pesapi_set_property_by_key(pesapi_env env, pesapi_value object, pesapi_key key, pesapi_value value);
+// values[i] = object[keys[i]], undefined if missing, return false if object is not an object
+PESAPI_EXTERN bool pesapi_get_properties(
+    pesapi_env env, pesapi_value object, size_t count, const pesapi_key keys[], pesapi_value values[]);
+
+// bulk copy of numbers between a c buffer and a js Array or TypedArray, a TypedArray of the same element type is
+// copied with memcpy. get/set return the number of elements copied, set grows an Array but not a TypedArray.
+PESAPI_EXTERN pesapi_value pesapi_create_array_from_buffer(
+    pesapi_env env, pesapi_element_type element_type, const void* data, size_t count);
+PESAPI_EXTERN size_t pesapi_get_array_elements(
+    pesapi_env env, pesapi_value array, uint32_t start, pesapi_element_type element_type, void* out, size_t count);
+PESAPI_EXTERN size_t pesapi_set_array_elements(
+    pesapi_env env, pesapi_value array, uint32_t start, pesapi_element_type element_type, const void* data, size_t count);
+
 PESAPI_EXTERN pesapi_value pesapi_call_function(
     pesapi_env env, pesapi_value func, pesapi_value this_object, int argc, const pesapi_value argv[]);
 
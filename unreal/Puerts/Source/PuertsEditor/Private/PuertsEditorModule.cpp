@@ -50,6 +50,8 @@ private:
 
     TSharedPtr<PUERTS_NAMESPACE::FSourceFileWatcher> SourceFileWatcher;
 
+    std::shared_ptr<PUERTS_NAMESPACE::DefaultJSModuleLoader> ModuleLoader;
+
     bool Enabled = false;
 
     std::function<void(const FString&, const FString&)> CmdImpl;
@@ -134,9 +136,18 @@ void FPuertsEditorModule::OnPostEngineInit()
                         UE_LOG(Puerts, Error, TEXT("read file fail for %s"), *InPath);
                     }
                 }
+            },
+            [this](const FString& InPath)
+            {
+                if (ModuleLoader)
+                {
+                    ModuleLoader->InvalidateSearchCache();
+                }
             });
-        JsEnv = MakeShared<PUERTS_NAMESPACE::FJsEnv>(
-            std::make_shared<PUERTS_NAMESPACE::DefaultJSModuleLoader>(TEXT("JavaScript")),
+        ModuleLoader = std::make_shared<PUERTS_NAMESPACE::DefaultJSModuleLoader>(TEXT("JavaScript"));
+        // SourceFileWatcher invalidates the loader when files are added or removed
+        ModuleLoader->SetCacheMisses(true);
+        JsEnv = MakeShared<PUERTS_NAMESPACE::FJsEnv>(ModuleLoader,
             std::make_shared<PUERTS_NAMESPACE::FDefaultLogger>(), -1,
             [this](const FString& InPath)
             {
@@ -162,6 +173,7 @@ void FPuertsEditorModule::ShutdownModule()
     {
         SourceFileWatcher.Reset();
     }
+    ModuleLoader.reset();
 }
 
 void FPuertsEditorModule::PreBeginPIE(bool bIsSimulating)
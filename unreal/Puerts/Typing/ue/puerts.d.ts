@@ -44,6 +44,9 @@ declare module "ue" {
         RemoveAt(Index: number): void;
         IsValidIndex(Index: number): boolean;
         Empty(): void;
+        AsTypedArray(): Int8Array | Uint8Array | Int16Array | Uint16Array | Int32Array | Uint32Array | Float32Array | Float64Array;
+        CopyFrom(Source: ArrayBufferView): void;
+        CopyTo(Target: ArrayBufferView): number;
         [Symbol.iterator](): IterableIterator<T>;
     }
     